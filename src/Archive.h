@@ -77,6 +77,9 @@ public:
     unsigned char const * get_buffer_ptr(void) const;
     Archive & update_buffer_ptr(size_t cDelta);
 
+    /// Returns the number of bytes that haven't been deserialized yet
+    size_t get_remaining_size(void) const;
+
     template <typename T> T deserialize(void);
 
     bool AtEnd(void) const;
@@ -197,6 +200,13 @@ inline Archive & Archive::update_buffer_ptr(size_t cDelta) {
     return *this;
 }
 
+inline size_t Archive::get_remaining_size(void) const {
+    if(Mode != ModeValue::Deserializing)
+        throw std::runtime_error("Invalid mode");
+
+    return static_cast<size_t>(_pEndBuffer - _pBuffer);
+}
+
 inline bool Archive::AtEnd(void) const {
     if(Mode != ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
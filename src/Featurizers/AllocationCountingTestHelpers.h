@@ -0,0 +1,38 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global `operator new` so that tests can verify that
+// steady-state inferencing doesn't allocate memory for intermediate results.
+// Replacement allocation functions can't be inline, so this header must only
+// be included by a single translation unit in each test executable.
+
+namespace Microsoft {
+namespace Featurizer {
+namespace TestHelpers {
+
+/// Number of calls to the global `operator new` made by the process
+static std::atomic<size_t>                  g_numAllocations(0);
+
+} // namespace TestHelpers
+} // namespace Featurizer
+} // namespace Microsoft
+
+void * operator new(size_t size) {
+    ++Microsoft::Featurizer::TestHelpers::g_numAllocations;
+
+    if(void *p = std::malloc(size ? size : 1))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
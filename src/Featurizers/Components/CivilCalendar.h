@@ -0,0 +1,324 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+// ----------------------------------------------------------------------
+// |
+// |  Conversions between days since 1970-01-01 and proleptic Gregorian
+// |  calendar dates, based on the algorithms described by Howard Hinnant in
+// |  "chrono-Compatible Low-Level Date Algorithms". All values are computed
+// |  with integer arithmetic (no calls into the C runtime, no time zones,
+// |  and no restriction to dates after 1970).
+// |
+// ----------------------------------------------------------------------
+
+/// Range of days since 1970-01-01 (roughly +/- 5.4 million years) for which
+/// the 32-bit calculations below don't overflow; values outside of this range
+/// are rejected by `SplitSeconds` and `SplitTimePoint`.
+static constexpr std::int32_t const         MinDays = -2000000000;
+static constexpr std::int32_t const         MaxDays = 2000000000;
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        CivilDate
+///  \brief         Calendar fields for a day. Conventions match those of
+///                 `std::tm` where they overlap.
+///
+struct CivilDate {
+    std::int32_t                            year;
+    std::uint8_t                            month;          // 1 through 12
+    std::uint8_t                            day;            // 1 through 31
+    std::uint8_t                            dayOfWeek;      // 0 (Sunday) through 6 (Saturday)
+    std::uint16_t                           dayOfYear;      // 0 through 365
+    std::uint8_t                            quarterOfYear;  // 1 through 4
+    std::uint8_t                            dayOfQuarter;   // 1 through 92
+    std::uint8_t                            weekIso;        // 1 through 53
+    std::int32_t                            yearIso;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        CivilDateColumns
+///  \brief         Struct-of-arrays output for `CivilFromDaysBatch`; each
+///                 pointer must reference a buffer with at least `cItems`
+///                 elements.
+///
+struct CivilDateColumns {
+    std::int32_t *                          pYear;
+    std::uint8_t *                          pMonth;
+    std::uint8_t *                          pDay;
+    std::uint8_t *                          pDayOfWeek;
+    std::uint16_t *                         pDayOfYear;
+    std::uint8_t *                          pQuarterOfYear;
+    std::uint8_t *                          pDayOfQuarter;
+    std::uint8_t *                          pWeekIso;
+    std::int32_t *                          pYearIso;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            DaysFromCivil
+///  \brief         Returns the number of days since 1970-01-01 for a date.
+///
+std::int32_t DaysFromCivil(std::int32_t year, std::uint32_t month, std::uint32_t day);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CivilFromDays
+///  \brief         Returns the calendar fields for the number of days since
+///                 1970-01-01, which must be in the range [MinDays, MaxDays].
+///
+CivilDate CivilFromDays(std::int32_t days);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CivilFromDaysBatch
+///  \brief         Calculates the calendar fields for `cItems` days (each of
+///                 which must be in the range [MinDays, MaxDays]), writing
+///                 each field to its own column.
+///
+///                 The work is split into a few passes over the batch that use
+///                 32-bit arithmetic without data-dependent branches, so compilers
+///                 can vectorize the loops with the instruction set available on
+///                 the target platform.
+///
+void CivilFromDaysBatch(std::int32_t const *pDays, size_t cItems, CivilDateColumns const &columns);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            SplitTimePoint
+///  \brief         Splits a time point into the number of days since 1970-01-01
+///                 and the number of seconds since midnight; times before
+///                 1970 are rounded towards negative infinity so that the
+///                 seconds are always positive. Throws `std::invalid_argument`
+///                 if the day is outside of the range [MinDays, MaxDays].
+///
+void SplitTimePoint(std::chrono::system_clock::time_point const &tp, std::int32_t &days, std::int32_t &secondsOfDay);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            SplitSeconds
+///  \brief         `SplitTimePoint` for the number of seconds since the epoch.
+///
+void SplitSeconds(std::int64_t secondsSinceEpoch, std::int32_t &days, std::int32_t &secondsOfDay);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+// 1970-01-01 is 719468 days after 0000-03-01, which is the epoch used by
+// the algorithms below (starting the year in March puts the leap day at
+// the end of the year).
+static constexpr std::int32_t const         CivilEpochOffset = 719468;
+static constexpr std::int32_t const         DaysPerEra = 146097;
+
+inline std::int32_t FloorDiv(std::int32_t value, std::int32_t divisor) {
+    return (value >= 0 ? value : value - (divisor - 1)) / divisor;
+}
+
+inline std::uint32_t IsLeapYear(std::int32_t year) {
+    return static_cast<std::uint32_t>((year & 3) == 0 && (year % 100 != 0 || year % 400 == 0));
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            YearAndDayOfYear
+///  \brief         Core of civil_from_days; produces the calendar year, the
+///                 month, the day of month, and the 0-based day of year (starting
+///                 in January).
+///
+inline void YearAndDayOfYear(
+    std::int32_t days,
+    std::int32_t &year,
+    std::uint32_t &month,
+    std::uint32_t &day,
+    std::uint32_t &dayOfYear
+) {
+    std::int32_t const                      z(days + CivilEpochOffset);
+    std::int32_t const                      era(FloorDiv(z, DaysPerEra));
+    std::uint32_t const                     doe(static_cast<std::uint32_t>(z - era * DaysPerEra));                  // [0, 146096]
+    std::uint32_t const                     yoe((doe - doe / 1460 + doe / 36524 - doe / 146096) / 365);             // [0, 399]
+    std::uint32_t const                     doyMarch(doe - (365 * yoe + yoe / 4 - yoe / 100));                      // [0, 365]
+    std::uint32_t const                     mp((5 * doyMarch + 2) / 153);                                           // [0, 11]
+    std::uint32_t const                     isJanOrFeb(static_cast<std::uint32_t>(mp >= 10));
+
+    day = doyMarch - (153 * mp + 2) / 5 + 1;
+    month = isJanOrFeb ? mp - 9 : mp + 3;
+    year = static_cast<std::int32_t>(yoe) + era * 400 + static_cast<std::int32_t>(isJanOrFeb);
+
+    // March 1 is day 59 (or 60 in a leap year) of the calendar year
+    dayOfYear = isJanOrFeb ? doyMarch - 306 : doyMarch + 59 + IsLeapYear(year);
+}
+
+inline std::uint32_t DayOfWeek(std::int32_t days) {
+    // 1970-01-01 was a Thursday
+    return static_cast<std::uint32_t>(days - FloorDiv(days + 4, 7) * 7 + 4);
+}
+
+inline std::uint32_t QuarterStartDayOfYear(std::uint32_t quarterOfYear, std::uint32_t isLeapYear) {
+    // Days before the first month of the quarter, using the same March-based
+    // month lengths as YearAndDayOfYear (Apr 1 is 90, Jul 1 is 181, Oct 1 is 273
+    // in a non-leap year).
+    std::uint32_t const                     monthFromMarch(quarterOfYear * 3 - 5);
+
+    return quarterOfYear == 1 ? 0 : 59 + isLeapYear + (153 * monthFromMarch + 2) / 5;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            IsoWeek
+///  \brief         ISO weeks start on Monday and belong to the ISO year that
+///                 contains their Thursday, so the ISO year and week of a day
+///                 are the calendar year and (0-based day of year / 7 + 1)
+///                 of the Thursday in the same week.
+///
+inline void IsoWeek(std::int32_t days, std::uint32_t dayOfWeek, std::int32_t &yearIso, std::uint32_t &weekIso) {
+    // Monday is 1, Sunday is 7
+    std::uint32_t const                     isoDayOfWeek(dayOfWeek == 0 ? 7 : dayOfWeek);
+    std::int32_t const                      thursday(days - static_cast<std::int32_t>(isoDayOfWeek) + 4);
+
+    std::uint32_t                           month;
+    std::uint32_t                           day;
+    std::uint32_t                           dayOfYear;
+
+    YearAndDayOfYear(thursday, yearIso, month, day, dayOfYear);
+    weekIso = dayOfYear / 7 + 1;
+}
+
+} // namespace Details
+
+inline std::int32_t DaysFromCivil(std::int32_t year, std::uint32_t month, std::uint32_t day) {
+    if(month < 1 || month > 12)
+        throw std::invalid_argument("month");
+    if(day < 1 || day > 31)
+        throw std::invalid_argument("day");
+
+    year -= static_cast<std::int32_t>(month <= 2);
+
+    std::int32_t const                      era(Details::FloorDiv(year, 400));
+    std::uint32_t const                     yoe(static_cast<std::uint32_t>(year - era * 400));                      // [0, 399]
+    std::uint32_t const                     doy((153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1);      // [0, 365]
+    std::uint32_t const                     doe(yoe * 365 + yoe / 4 - yoe / 100 + doy);                              // [0, 146096]
+
+    return era * Details::DaysPerEra + static_cast<std::int32_t>(doe) - Details::CivilEpochOffset;
+}
+
+inline CivilDate CivilFromDays(std::int32_t days) {
+    std::int32_t                            year;
+    std::uint32_t                           month;
+    std::uint32_t                           day;
+    std::uint32_t                           dayOfYear;
+
+    Details::YearAndDayOfYear(days, year, month, day, dayOfYear);
+
+    std::uint32_t const                     dayOfWeek(Details::DayOfWeek(days));
+    std::uint32_t const                     quarterOfYear((month + 2) / 3);
+
+    std::int32_t                            yearIso;
+    std::uint32_t                           weekIso;
+
+    Details::IsoWeek(days, dayOfWeek, yearIso, weekIso);
+
+    CivilDate                               result;
+
+    result.year = year;
+    result.month = static_cast<std::uint8_t>(month);
+    result.day = static_cast<std::uint8_t>(day);
+    result.dayOfWeek = static_cast<std::uint8_t>(dayOfWeek);
+    result.dayOfYear = static_cast<std::uint16_t>(dayOfYear);
+    result.quarterOfYear = static_cast<std::uint8_t>(quarterOfYear);
+    result.dayOfQuarter = static_cast<std::uint8_t>(dayOfYear - Details::QuarterStartDayOfYear(quarterOfYear, Details::IsLeapYear(year)) + 1);
+    result.weekIso = static_cast<std::uint8_t>(weekIso);
+    result.yearIso = yearIso;
+
+    return result;
+}
+
+inline void CivilFromDaysBatch(std::int32_t const *pDays, size_t cItems, CivilDateColumns const &columns) {
+    if(cItems == 0)
+        return;
+
+    if(pDays == nullptr)
+        throw std::invalid_argument("pDays");
+
+    if(
+        columns.pYear == nullptr
+        || columns.pMonth == nullptr
+        || columns.pDay == nullptr
+        || columns.pDayOfWeek == nullptr
+        || columns.pDayOfYear == nullptr
+        || columns.pQuarterOfYear == nullptr
+        || columns.pDayOfQuarter == nullptr
+        || columns.pWeekIso == nullptr
+        || columns.pYearIso == nullptr
+    )
+        throw std::invalid_argument("columns");
+
+    for(size_t i = 0; i < cItems; ++i) {
+        std::int32_t                        year;
+        std::uint32_t                       month;
+        std::uint32_t                       day;
+        std::uint32_t                       dayOfYear;
+
+        Details::YearAndDayOfYear(pDays[i], year, month, day, dayOfYear);
+
+        std::uint32_t const                 quarterOfYear((month + 2) / 3);
+
+        columns.pYear[i] = year;
+        columns.pMonth[i] = static_cast<std::uint8_t>(month);
+        columns.pDay[i] = static_cast<std::uint8_t>(day);
+        columns.pDayOfYear[i] = static_cast<std::uint16_t>(dayOfYear);
+        columns.pQuarterOfYear[i] = static_cast<std::uint8_t>(quarterOfYear);
+        columns.pDayOfQuarter[i] = static_cast<std::uint8_t>(dayOfYear - Details::QuarterStartDayOfYear(quarterOfYear, Details::IsLeapYear(year)) + 1);
+    }
+
+    for(size_t i = 0; i < cItems; ++i)
+        columns.pDayOfWeek[i] = static_cast<std::uint8_t>(Details::DayOfWeek(pDays[i]));
+
+    for(size_t i = 0; i < cItems; ++i) {
+        std::int32_t                        yearIso;
+        std::uint32_t                       weekIso;
+
+        Details::IsoWeek(pDays[i], columns.pDayOfWeek[i], yearIso, weekIso);
+
+        columns.pWeekIso[i] = static_cast<std::uint8_t>(weekIso);
+        columns.pYearIso[i] = yearIso;
+    }
+}
+
+inline void SplitTimePoint(std::chrono::system_clock::time_point const &tp, std::int32_t &days, std::int32_t &secondsOfDay) {
+    std::chrono::system_clock::duration const           sinceEpoch(tp.time_since_epoch());
+    std::chrono::seconds                                seconds(std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch));
+
+    // duration_cast truncates towards 0
+    if(seconds > sinceEpoch)
+        seconds -= std::chrono::seconds(1);
+
+    SplitSeconds(static_cast<std::int64_t>(seconds.count()), days, secondsOfDay);
+}
+
+inline void SplitSeconds(std::int64_t secondsSinceEpoch, std::int32_t &days, std::int32_t &secondsOfDay) {
+    static constexpr std::int64_t const     SecondsPerDay = 60 * 60 * 24;
+
+    std::int64_t const                      totalDays((secondsSinceEpoch >= 0 ? secondsSinceEpoch : secondsSinceEpoch - (SecondsPerDay - 1)) / SecondsPerDay);
+
+    if(totalDays < MinDays || totalDays > MaxDays)
+        throw std::invalid_argument("secondsSinceEpoch");
+
+    days = static_cast<std::int32_t>(totalDays);
+    secondsOfDay = static_cast<std::int32_t>(secondsSinceEpoch - totalDays * SecondsPerDay);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,502 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CompactStringIndexMap
+///  \brief         Immutable map of strings to indexes that is optimized for
+///                 memory usage. `std::unordered_map<std::string, std::uint32_t>`
+///                 requires a heap-allocated node (and potentially a heap-allocated
+///                 string) for every entry; this object stores all data in a
+///                 single contiguous image:
+///
+///                     [0]     Number of items (N)
+///                     [1]     Number of buckets (B, always a power of 2)
+///                     [2]     Number of string bytes (S)
+///                     [3]     String offsets (N + 1 uint32 values)
+///                     [...]   Values (N uint32 values)
+///                     [...]   Buckets (B uint32 values, item index + 1 or 0 if empty)
+///                     [...]   String bytes (S bytes, padded to a multiple of 4)
+///
+///                 Lookups hash the key with 32-bit FNV-1a and use linear probing;
+///                 the number of buckets is at least twice the number of items.
+///
+///                 The image is an in-memory representation only. Archives use
+///                 the `std::unordered_map` layout (see `Traits` below) so that
+///                 existing models load unchanged, which means that the map is
+///                 always rebuilt in memory during deserialization and can't be
+///                 used directly from an mmap.
+///
+class CompactStringIndexMap {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using key_type                          = std::string;
+    using mapped_type                       = std::uint32_t;
+    using IndexMap                          = std::unordered_map<std::string, std::uint32_t>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    CompactStringIndexMap(void);
+
+    // Implicit conversion is intentional, as this object replaces `IndexMap` once
+    // training is complete.
+    CompactStringIndexMap(IndexMap const &map);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Create
+    ///  \brief         Creates a map from items that are already ordered. An
+    ///                 exception is thrown if keys are duplicated.
+    ///
+    static CompactStringIndexMap Create(std::vector<std::pair<std::string, std::uint32_t>> const &items);
+
+    CompactStringIndexMap(CompactStringIndexMap const &other);
+    CompactStringIndexMap(CompactStringIndexMap &&other);
+
+    CompactStringIndexMap & operator =(CompactStringIndexMap const &) = delete;
+    CompactStringIndexMap & operator =(CompactStringIndexMap &&) = delete;
+
+    ~CompactStringIndexMap(void) = default;
+
+    size_t size(void) const;
+    bool empty(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns a pointer to the index associated with the key
+    ///                 or nullptr if the key doesn't exist.
+    ///
+    std::uint32_t const * find(char const *pKey, size_t cbKey) const;
+    std::uint32_t const * find(std::string const &key) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            at
+    ///  \brief         Returns the index associated with the key, throwing
+    ///                 `std::out_of_range` if the key doesn't exist.
+    ///
+    std::uint32_t at(std::string const &key) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            enumerate
+    ///  \brief         Invokes the callback for each item in the map.
+    ///
+    template <typename CallbackT>           // void (char const *pKey, size_t cbKey, std::uint32_t value)
+    void enumerate(CallbackT const &callback) const;
+
+    IndexMap to_map(void) const;
+
+    bool operator==(CompactStringIndexMap const &other) const;
+    bool operator!=(CompactStringIndexMap const &other) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr size_t const           NumHeaderValues = 3;
+    static constexpr size_t const           MaxNumItems = static_cast<size_t>(1) << 30;
+
+    std::vector<std::uint32_t>              _storage;
+
+    std::uint32_t                           _numItems;
+    std::uint32_t                           _numBuckets;
+    std::uint32_t                           _cbStrings;
+
+    std::uint32_t const *                   _pOffsets;
+    std::uint32_t const *                   _pValues;
+    std::uint32_t const *                   _pBuckets;
+    char const *                            _pStrings;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    CompactStringIndexMap(std::vector<std::uint32_t> storage);
+
+    void init(std::uint32_t const *pImage, size_t cbImage);
+
+    template <typename IteratorT, typename GetKeyFuncT, typename GetValueFuncT>
+    static std::vector<std::uint32_t> CreateImage(IteratorT begin, IteratorT end, size_t numItems, GetKeyFuncT const &getKeyFunc, GetValueFuncT const &getValueFunc);
+
+    static std::uint32_t Hash(char const *pKey, size_t cbKey);
+    static size_t NumImageValues(std::uint32_t numItems, std::uint32_t numBuckets, std::uint32_t cbStrings);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline CompactStringIndexMap::CompactStringIndexMap(void) :
+    CompactStringIndexMap(Create(std::vector<std::pair<std::string, std::uint32_t>>())) {
+}
+
+inline CompactStringIndexMap::CompactStringIndexMap(IndexMap const &map) :
+    CompactStringIndexMap(
+        [&map](void) {
+            // Order the items by value (and then by key) so that the image is deterministic
+            std::vector<IndexMap::value_type const *>   items;
+
+            items.reserve(map.size());
+
+            for(auto const &kvp : map)
+                items.emplace_back(&kvp);
+
+            std::sort(
+                items.begin(),
+                items.end(),
+                [](IndexMap::value_type const *pA, IndexMap::value_type const *pB) {
+                    if(pA->second != pB->second)
+                        return pA->second < pB->second;
+
+                    return pA->first < pB->first;
+                }
+            );
+
+            return CreateImage(
+                items.cbegin(),
+                items.cend(),
+                items.size(),
+                [](IndexMap::value_type const *pItem) -> std::string const & { return pItem->first; },
+                [](IndexMap::value_type const *pItem) { return pItem->second; }
+            );
+        }()
+    ) {
+}
+
+/*static*/ inline CompactStringIndexMap CompactStringIndexMap::Create(std::vector<std::pair<std::string, std::uint32_t>> const &items) {
+    // ----------------------------------------------------------------------
+    using Item                              = std::pair<std::string, std::uint32_t>;
+    // ----------------------------------------------------------------------
+
+    return CompactStringIndexMap(
+        CreateImage(
+            items.cbegin(),
+            items.cend(),
+            items.size(),
+            [](Item const &item) -> std::string const & { return item.first; },
+            [](Item const &item) { return item.second; }
+        )
+    );
+}
+
+inline CompactStringIndexMap::CompactStringIndexMap(CompactStringIndexMap const &other) :
+    CompactStringIndexMap(other._storage) {
+}
+
+inline CompactStringIndexMap::CompactStringIndexMap(CompactStringIndexMap &&other) :
+    CompactStringIndexMap(std::move(other._storage)) {
+}
+
+inline size_t CompactStringIndexMap::size(void) const {
+    return _numItems;
+}
+
+inline bool CompactStringIndexMap::empty(void) const {
+    return _numItems == 0;
+}
+
+inline std::uint32_t const * CompactStringIndexMap::find(char const *pKey, size_t cbKey) const {
+    std::uint32_t const                     mask(_numBuckets - 1);
+    std::uint32_t                           bucket(Hash(pKey, cbKey) & mask);
+
+    while(true) {
+        std::uint32_t const                 entry(_pBuckets[bucket]);
+
+        if(entry == 0)
+            return nullptr;
+
+        std::uint32_t const                 index(entry - 1);
+        std::uint32_t const                 offset(_pOffsets[index]);
+
+        if(
+            _pOffsets[index + 1] - offset == cbKey
+            && (cbKey == 0 || std::memcmp(_pStrings + offset, pKey, cbKey) == 0)
+        )
+            return _pValues + index;
+
+        bucket = (bucket + 1) & mask;
+    }
+}
+
+inline std::uint32_t const * CompactStringIndexMap::find(std::string const &key) const {
+    return find(key.data(), key.size());
+}
+
+inline std::uint32_t CompactStringIndexMap::at(std::string const &key) const {
+    std::uint32_t const *                   pValue(find(key));
+
+    if(pValue == nullptr)
+        throw std::out_of_range("key");
+
+    return *pValue;
+}
+
+template <typename CallbackT>
+void CompactStringIndexMap::enumerate(CallbackT const &callback) const {
+    for(std::uint32_t index = 0; index < _numItems; ++index)
+        callback(_pStrings + _pOffsets[index], static_cast<size_t>(_pOffsets[index + 1] - _pOffsets[index]), _pValues[index]);
+}
+
+inline CompactStringIndexMap::IndexMap CompactStringIndexMap::to_map(void) const {
+    IndexMap                                result;
+
+    result.reserve(_numItems);
+
+    enumerate(
+        [&result](char const *pKey, size_t cbKey, std::uint32_t value) {
+            result.emplace(std::string(pKey, cbKey), value);
+        }
+    );
+
+    return result;
+}
+
+inline bool CompactStringIndexMap::operator==(CompactStringIndexMap const &other) const {
+    if(_numItems != other._numItems)
+        return false;
+
+    bool                                    result(true);
+
+    enumerate(
+        [&other, &result](char const *pKey, size_t cbKey, std::uint32_t value) {
+            if(result == false)
+                return;
+
+            std::uint32_t const *           pOtherValue(other.find(pKey, cbKey));
+
+            result = pOtherValue != nullptr && *pOtherValue == value;
+        }
+    );
+
+    return result;
+}
+
+inline bool CompactStringIndexMap::operator!=(CompactStringIndexMap const &other) const {
+    return (*this == other) == false;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline CompactStringIndexMap::CompactStringIndexMap(std::vector<std::uint32_t> storage) :
+    _storage(std::move(storage)) {
+    init(_storage.data(), _storage.size() * sizeof(std::uint32_t));
+}
+
+inline void CompactStringIndexMap::init(std::uint32_t const *pImage, size_t cbImage) {
+    if(cbImage < NumHeaderValues * sizeof(std::uint32_t) || cbImage % sizeof(std::uint32_t) != 0)
+        throw std::invalid_argument("Invalid image");
+
+    std::uint32_t const                     numItems(pImage[0]);
+    std::uint32_t const                     numBuckets(pImage[1]);
+    std::uint32_t const                     cbStrings(pImage[2]);
+
+    if(numBuckets == 0 || (numBuckets & (numBuckets - 1)) != 0 || numBuckets <= numItems)
+        throw std::invalid_argument("Invalid image buckets");
+
+    if(NumImageValues(numItems, numBuckets, cbStrings) * sizeof(std::uint32_t) != cbImage)
+        throw std::invalid_argument("Invalid image size");
+
+    _numItems = numItems;
+    _numBuckets = numBuckets;
+    _cbStrings = cbStrings;
+
+    _pOffsets = pImage + NumHeaderValues;
+    _pValues = _pOffsets + numItems + 1;
+    _pBuckets = _pValues + numItems;
+    _pStrings = reinterpret_cast<char const *>(_pBuckets + numBuckets);
+
+    if(_pOffsets[numItems] != cbStrings)
+        throw std::invalid_argument("Invalid image offsets");
+}
+
+template <typename IteratorT, typename GetKeyFuncT, typename GetValueFuncT>
+/*static*/ std::vector<std::uint32_t> CompactStringIndexMap::CreateImage(IteratorT begin, IteratorT end, size_t numItemsParam, GetKeyFuncT const &getKeyFunc, GetValueFuncT const &getValueFunc) {
+    // The number of buckets is a power of 2 that is at least twice the number of
+    // items, and must be representable as a 32-bit value.
+    if(numItemsParam > MaxNumItems)
+        throw std::invalid_argument("Too many items");
+
+    std::uint32_t const                     numItems(static_cast<std::uint32_t>(numItemsParam));
+
+    // Calculate the size of the image
+    size_t                                  cbStringsParam(0);
+
+    for(IteratorT iter = begin; iter != end; ++iter)
+        cbStringsParam += getKeyFunc(*iter).size();
+
+    if(cbStringsParam > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("Too many string bytes");
+
+    std::uint32_t const                     cbStrings(static_cast<std::uint32_t>(cbStringsParam));
+    std::uint32_t                           numBuckets(1);
+
+    while(numBuckets < numItems * 2 || numBuckets <= numItems)
+        numBuckets <<= 1;
+
+    std::vector<std::uint32_t>              image(NumImageValues(numItems, numBuckets, cbStrings), 0);
+
+    image[0] = numItems;
+    image[1] = numBuckets;
+    image[2] = cbStrings;
+
+    std::uint32_t * const                   pOffsets(image.data() + NumHeaderValues);
+    std::uint32_t * const                   pValues(pOffsets + numItems + 1);
+    std::uint32_t * const                   pBuckets(pValues + numItems);
+    char * const                            pStrings(reinterpret_cast<char *>(pBuckets + numBuckets));
+
+    std::uint32_t const                     mask(numBuckets - 1);
+    std::uint32_t                           index(0);
+    std::uint32_t                           offset(0);
+
+    for(IteratorT iter = begin; iter != end; ++iter) {
+        std::string const &                 key(getKeyFunc(*iter));
+
+        if(key.empty() == false)
+            std::memcpy(pStrings + offset, key.data(), key.size());
+
+        pOffsets[index] = offset;
+        pValues[index] = getValueFunc(*iter);
+
+        offset += static_cast<std::uint32_t>(key.size());
+
+        // Insert the item into the hash index
+        std::uint32_t                       bucket(Hash(key.data(), key.size()) & mask);
+
+        while(pBuckets[bucket] != 0) {
+            std::uint32_t const             otherIndex(pBuckets[bucket] - 1);
+
+            if(
+                pOffsets[otherIndex + 1] - pOffsets[otherIndex] == key.size()
+                && (key.empty() || std::memcmp(pStrings + pOffsets[otherIndex], key.data(), key.size()) == 0)
+            )
+                throw std::invalid_argument("Duplicate key");
+
+            bucket = (bucket + 1) & mask;
+        }
+
+        pBuckets[bucket] = index + 1;
+
+        ++index;
+
+        // The next offset is needed to compare subsequent keys to this one
+        pOffsets[index] = offset;
+    }
+
+    assert(index == numItems);
+    assert(offset == cbStrings);
+
+    return image;
+}
+
+/*static*/ inline std::uint32_t CompactStringIndexMap::Hash(char const *pKey, size_t cbKey) {
+    // 32-bit FNV-1a
+    std::uint32_t                           hash(2166136261u);
+    char const * const                      pEnd(pKey + cbKey);
+
+    while(pKey != pEnd) {
+        hash ^= static_cast<unsigned char>(*pKey);
+        hash *= 16777619u;
+        ++pKey;
+    }
+
+    return hash;
+}
+
+/*static*/ inline size_t CompactStringIndexMap::NumImageValues(std::uint32_t numItems, std::uint32_t numBuckets, std::uint32_t cbStrings) {
+    return NumHeaderValues
+        + static_cast<size_t>(numItems) + 1             // Offsets
+        + static_cast<size_t>(numItems)                 // Values
+        + static_cast<size_t>(numBuckets)               // Buckets
+        + (static_cast<size_t>(cbStrings) + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t);
+}
+
+} // namespace Components
+} // namespace Featurizers
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Traits
+///  \brief         Serializes a `CompactStringIndexMap` using the same layout
+///                 as `std::unordered_map<std::string, std::uint32_t>`, which
+///                 means that the object can be used to replace an existing map
+///                 without changing the archive format.
+///
+template <>
+struct Traits<Featurizers::Components::CompactStringIndexMap> : public TraitsImpl<Featurizers::Components::CompactStringIndexMap> {
+    template <typename ArchiveT>
+    static ArchiveT & serialize(ArchiveT &ar, Featurizers::Components::CompactStringIndexMap const &value) {
+        Traits<std::uint32_t>::serialize(ar, static_cast<std::uint32_t>(value.size()));
+
+        value.enumerate(
+            [&ar](char const *pKey, size_t cbKey, std::uint32_t v) {
+                Traits<std::uint32_t>::serialize(ar, static_cast<std::uint32_t>(cbKey));
+
+                if(cbKey != 0)
+                    ar.serialize(reinterpret_cast<unsigned char const *>(pKey), cbKey);
+
+                Traits<std::uint32_t>::serialize(ar, v);
+            }
+        );
+
+        return ar;
+    }
+
+    template <typename ArchiveT>
+    static Featurizers::Components::CompactStringIndexMap deserialize(ArchiveT &ar) {
+        std::vector<std::pair<std::string, std::uint32_t>>  items;
+        std::uint32_t                                       numItems(Traits<std::uint32_t>::deserialize(ar));
+
+        // Each item is at least a key length and a value; don't trust the count
+        // beyond what the archive can hold.
+        if(numItems > ar.get_remaining_size() / (sizeof(std::uint32_t) * 2))
+            throw std::runtime_error("Invalid number of items");
+
+        items.reserve(numItems);
+
+        while(numItems) {
+            std::string                     key(Traits<std::string>::deserialize(ar));
+            std::uint32_t                   value(Traits<std::uint32_t>::deserialize(ar));
+
+            items.emplace_back(std::move(key), std::move(value));
+            --numItems;
+        }
+
+        return Featurizers::Components::CompactStringIndexMap::Create(items);
+    }
+};
+
+} // namespace Featurizer
+} // namespace Microsoft
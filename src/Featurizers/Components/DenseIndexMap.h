@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DenseIndexMap
+///  \brief         Direct-indexed lookup table created from an IndexMap whose
+///                 keys are integers in a dense range. Each slot contains the
+///                 value that is ready to be emitted by a transformer (the index
+///                 plus an offset), or a designated value for keys that were not
+///                 seen during training, so a lookup is a subtraction, a clamp
+///                 and a load.
+///
+///                 This is the generic version, which is never enabled; transformers
+///                 fall back to the IndexMap when `is_enabled` returns false.
+///
+template <typename T, typename EnableIfT=void>
+class DenseIndexMap {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename MapT>
+    DenseIndexMap(MapT const &, std::uint32_t, std::uint32_t) {}
+
+    bool is_enabled(void) const { return false; }
+
+    std::uint32_t lookup(T const &) const { throw std::runtime_error("Dense lookups are not enabled"); }
+
+    template <typename OutputT>
+    void lookup(T const *, size_t, OutputT *) const { throw std::runtime_error("Dense lookups are not enabled"); }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DenseIndexMap
+///  \brief         Version for integral keys. The table is only created when
+///                 the number of slots required is within `MaxNumEntries` and
+///                 is not significantly larger than the number of keys.
+///
+template <typename T>
+class DenseIndexMap<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint64_t const    MinNumEntries = 4096;
+    static constexpr std::uint64_t const    MaxNumEntries = 1 << 24;
+    static constexpr std::uint64_t const    MaxEntriesPerKey = 8;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Constructor
+    ///  \brief         Creates the table; slots are populated with the map's
+    ///                 value + `offset`, while slots for keys that aren't in the
+    ///                 map (and keys outside of the table's range) produce
+    ///                 `missingValue`.
+    ///
+    template <typename MapT>
+    DenseIndexMap(MapT const &map, std::uint32_t offset, std::uint32_t missingValue);
+
+    bool is_enabled(void) const;
+
+    std::uint32_t lookup(T value) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            lookup
+    ///  \brief         Batch kernel; writes the value for each input to `pOutput`.
+    ///                 The loop doesn't contain any branches, which allows the
+    ///                 compiler to vectorize it when gathers are available.
+    ///
+    template <typename OutputT>
+    void lookup(T const *pInput, size_t cItems, OutputT *pOutput) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using UnsignedType                      = typename std::make_unsigned<typename std::conditional<std::is_same<T, bool>::value, unsigned char, T>::type>::type;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    UnsignedType                            _minValue;
+
+    // The last slot is always `missingValue` and is used for all out-of-range keys
+    std::vector<std::uint32_t>              _table;
+    std::uint64_t                           _maxSlot;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+template <typename MapT>
+DenseIndexMap<T, typename std::enable_if<std::is_integral<T>::value>::type>::DenseIndexMap(MapT const &map, std::uint32_t offset, std::uint32_t missingValue) :
+    _minValue(0),
+    _maxSlot(0) {
+    if(map.empty())
+        return;
+
+    // Calculate the range
+    T                                       minValue(map.begin()->first);
+    T                                       maxValue(minValue);
+
+    for(auto const &kvp : map) {
+        if(kvp.first < minValue)
+            minValue = kvp.first;
+        if(kvp.first > maxValue)
+            maxValue = kvp.first;
+    }
+
+    // Unsigned arithmetic is well-defined when the range spans the entire type
+    std::uint64_t const                     range(static_cast<std::uint64_t>(static_cast<UnsignedType>(static_cast<UnsignedType>(maxValue) - static_cast<UnsignedType>(minValue))));
+
+    if(range >= MaxNumEntries - 1)
+        return;
+
+    std::uint64_t const                     numEntries(range + 1);
+
+    if(numEntries > MinNumEntries && numEntries > static_cast<std::uint64_t>(map.size()) * MaxEntriesPerKey)
+        return;
+
+    _minValue = static_cast<UnsignedType>(minValue);
+    _maxSlot = numEntries;
+    _table.assign(static_cast<size_t>(numEntries + 1), missingValue);
+
+    for(auto const &kvp : map)
+        _table[static_cast<size_t>(static_cast<UnsignedType>(static_cast<UnsignedType>(kvp.first) - _minValue))] = kvp.second + offset;
+}
+
+template <typename T>
+bool DenseIndexMap<T, typename std::enable_if<std::is_integral<T>::value>::type>::is_enabled(void) const {
+    return _table.empty() == false;
+}
+
+template <typename T>
+std::uint32_t DenseIndexMap<T, typename std::enable_if<std::is_integral<T>::value>::type>::lookup(T value) const {
+    std::uint64_t const                     slot(static_cast<UnsignedType>(static_cast<UnsignedType>(value) - _minValue));
+
+    return _table[static_cast<size_t>(std::min(slot, _maxSlot))];
+}
+
+template <typename T>
+template <typename OutputT>
+void DenseIndexMap<T, typename std::enable_if<std::is_integral<T>::value>::type>::lookup(T const *pInput, size_t cItems, OutputT *pOutput) const {
+    std::uint32_t const * const             pTable(_table.data());
+    UnsignedType const                      minValue(_minValue);
+    std::uint64_t const                     maxSlot(_maxSlot);
+
+    for(size_t i = 0; i < cItems; ++i) {
+        std::uint64_t const                 slot(static_cast<UnsignedType>(static_cast<UnsignedType>(pInput[i]) - minValue));
+
+        pOutput[i] = static_cast<OutputT>(pTable[static_cast<size_t>(slot < maxSlot ? slot : maxSlot)]);
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
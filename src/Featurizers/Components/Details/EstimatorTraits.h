@@ -72,6 +72,34 @@ struct IsTransformerEstimator {
     static_assert(IsTransformerEstimator<FitEstimator<char>>::value == false, "");
 #endif
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         HasTrainingStateMethods
+///  \brief         Has a constexpr bool value set to true if the provided
+///                 object has the methods:
+///
+///                     void save_training_state(Archive &ar) const
+///                     void restore_training_state(Archive &ar)
+///
+///                 Estimators with these methods can have the state
+///                 accumulated by `fit` saved and restored into a newly
+///                 created Estimator that has begun training.
+///
+template <typename T>
+class HasTrainingStateMethods {
+private:
+    template <typename U> static constexpr std::false_type Check(...);
+
+    template <typename U>
+    static constexpr std::true_type Check(
+        U *,
+        decltype(std::declval<U const &>().save_training_state(std::declval<Archive &>())) *,
+        decltype(std::declval<U &>().restore_training_state(std::declval<Archive &>())) *
+    );
+
+public:
+    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr, nullptr))>::value;
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         EstimatorOutputTypeImpl
 ///  \brief         Output type for `TransformerEstimator` objects.
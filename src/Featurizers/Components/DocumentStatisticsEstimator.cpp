@@ -374,10 +374,13 @@ DocumentStatisticsAnnotationData Details::DocumentStatisticsTrainingOnlyPolicy::
 ParseFunctionType DocumentParseFuncGenerator(AnalyzerMethod const &analyzer, std::string const & regexToken, std::uint32_t const & ngramRangeMin, std::uint32_t const & ngramRangeMax) {
     if (analyzer == AnalyzerMethod::Word) {
         if (!regexToken.empty()) {
-            return [regexToken] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+            // Compile the regex once rather than for every document
+            std::regex                      regex(regexToken);
+
+            return [regex] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
                 Microsoft::Featurizer::Strings::ParseRegex<std::string::const_iterator, std::regex>(
                     input,
-                    std::regex(regexToken),
+                    regex,
                     callback
                 );
             };
@@ -424,25 +427,41 @@ ParseFunctionType DocumentParseFuncGenerator(AnalyzerMethod const &analyzer, std
 }
 
 std::string DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max) {
-
-    std::string decoratedInput = lower ? Strings::ToLower(input) : input;
     std::string processedInput;
 
+    DocumentDecorator(input, lower, analyzer, regex, ngram_min, ngram_max, processedInput);
+    return processedInput;
+}
+
+void DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max, std::string &output) {
+    // All modifications are made in place so that the capacity of `output` is
+    // reused; moving the string in and out of `ReplaceAndDeDuplicate` transfers
+    // the buffer rather than copying it.
+    output.assign(input);
+
+    if(lower) {
+        //static_cast<char> is to suppress MSVC compiler warning on implicitly conversion of int to char
+        std::transform(output.begin(), output.end(), output.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+    }
+
     if (analyzer == AnalyzerMethod::Word) {
-        if (regex.empty() && !(ngram_min == 1 && ngram_max == 1)) {
-            processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput);
-        } else {
-            processedInput = decoratedInput;
-        }
+        if (regex.empty() && !(ngram_min == 1 && ngram_max == 1))
+            output = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(std::move(output));
     } else if (analyzer == AnalyzerMethod::Char) {
-        processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput);
+        output = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(std::move(output));
     } else {
         assert(analyzer == AnalyzerMethod::Charwb);
-        auto predicate = [] (char c) {return std::isspace(c);};
-        std::string processedString(Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput));
-        processedInput = Microsoft::Featurizer::Strings::Details::StringPadding<std::function<bool (char)>>(processedString, predicate);
+        output = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(std::move(output));
+
+        // Equivalent to `Strings::Details::StringPadding`
+        bool const                          isFirstSpace(std::isspace(output.at(0)) != 0);
+        bool const                          isLastSpace(std::isspace(output.at(output.length() - 1)) != 0);
+
+        if(!isFirstSpace)
+            output.insert(output.begin(), ' ');
+        if(!isLastSpace)
+            output.push_back(' ');
     }
-    return processedInput;
 }
 
 } // namespace Components
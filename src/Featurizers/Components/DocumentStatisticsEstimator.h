@@ -10,6 +10,8 @@
 #include <queue>
 #include <regex>
 #include <set>
+#include <tuple>
+#include <vector>
 
 #include "TrainingOnlyEstimatorImpl.h"
 #include "IndexMapEstimator.h"
@@ -241,6 +243,88 @@ DocumentStatisticsAnnotationData::FrequencyAndIndexMap MergeTwoMapsWithSameKeys(
 ParseFunctionType DocumentParseFuncGenerator(AnalyzerMethod const &analyzer, std::string const & regexToken, std::uint32_t const & ngramRangeMin, std::uint32_t const & ngramRangeMax);
 std::string DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max);
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            DocumentDecorator
+///  \brief         Decorates the input in the same way as the function above,
+///                 but writes the result into `output` so that the buffer's
+///                 capacity can be reused across documents.
+///
+void DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max, std::string &output);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DocumentScratchArena
+///  \brief         Scratch state used by transformers when processing a single
+///                 document. The arena is reset (but its memory is not released)
+///                 before each document, which means that once the buffers have
+///                 grown to the size of the largest document seen, transforming
+///                 a document doesn't allocate any intermediate memory.
+///
+///                 Note that an arena must not be shared across threads.
+///
+template <typename ValueT>
+class DocumentScratchArena {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using IterRangeType                     = std::tuple<StringIterator, StringIterator>;
+    using ResultType                        = std::tuple<std::uint32_t, ValueT>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    std::string                             DecoratedInput;
+    std::vector<IterRangeType>              Terms;
+    std::string                             Term;
+    std::vector<ResultType>                 Results;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    DocumentScratchArena(void) = default;
+    ~DocumentScratchArena(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(DocumentScratchArena);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            reset
+    ///  \brief         Prepares the arena for a new document.
+    ///
+    void reset(void);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            decorate_and_parse
+    ///  \brief         Decorates the input document and collects all of the
+    ///                 terms produced by the parse function.
+    ///
+    void decorate_and_parse(
+        std::string const &input,
+        ParseFunctionType const &parseFunc,
+        bool lower,
+        AnalyzerMethod analyzer,
+        std::string const &regex,
+        std::uint32_t ngramMin,
+        std::uint32_t ngramMax
+    );
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            enumerate_unique_terms
+    ///  \brief         Invokes the callback once for each unique term collected
+    ///                 in `decorate_and_parse` (in the order defined by `IterRangeComp`).
+    ///                 The term is provided as a string that is owned by the arena
+    ///                 along with the number of times that the term appeared in the
+    ///                 document.
+    ///
+    template <typename CallbackT>           // void (std::string const &term, std::uint32_t numAppearances)
+    void enumerate_unique_terms(CallbackT const &callback);
+};
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -338,6 +422,68 @@ void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &in
     _totalNumDocuments += 1;
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  DocumentScratchArena
+// |
+// ----------------------------------------------------------------------
+template <typename ValueT>
+void DocumentScratchArena<ValueT>::reset(void) {
+    // `clear` doesn't release the memory associated with the containers
+    DecoratedInput.clear();
+    Terms.clear();
+    Term.clear();
+    Results.clear();
+}
+
+template <typename ValueT>
+void DocumentScratchArena<ValueT>::decorate_and_parse(
+    std::string const &input,
+    ParseFunctionType const &parseFunc,
+    bool lower,
+    AnalyzerMethod analyzer,
+    std::string const &regex,
+    std::uint32_t ngramMin,
+    std::uint32_t ngramMax
+) {
+    reset();
+
+    DocumentDecorator(input, lower, analyzer, regex, ngramMin, ngramMax, DecoratedInput);
+
+    std::vector<IterRangeType> &            terms(Terms);
+
+    parseFunc(
+        DecoratedInput,
+        [&terms](StringIterator begin, StringIterator end) {
+            terms.emplace_back(begin, end);
+        }
+    );
+}
+
+template <typename ValueT>
+template <typename CallbackT>
+void DocumentScratchArena<ValueT>::enumerate_unique_terms(CallbackT const &callback) {
+    // Sorting the ranges in place (rather than inserting them into a map) groups
+    // duplicate terms together without allocating any memory.
+    std::sort(Terms.begin(), Terms.end(), IterRangeComp());
+
+    IterRangeComp const                     comp;
+    typename std::vector<IterRangeType>::const_iterator         iter(Terms.cbegin());
+    typename std::vector<IterRangeType>::const_iterator const   end(Terms.cend());
+
+    while(iter != end) {
+        typename std::vector<IterRangeType>::const_iterator     next(iter + 1);
+
+        while(next != end && comp(*iter, *next) == false)
+            ++next;
+
+        Term.assign(std::get<0>(*iter), std::get<1>(*iter));
+        callback(static_cast<std::string const &>(Term), static_cast<std::uint32_t>(std::distance(iter, next)));
+
+        iter = next;
+    }
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -4,10 +4,17 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <list>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "../../Archive.h"
 #include "../../Featurizer.h"
+#include "../../Traits.h"
 #include "Details/EstimatorTraits.h"
+#include "GrainPartitioner.h"
+#include "ScratchFile.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -31,7 +38,7 @@ public:
             GrainT,
             AnnotationPtr,
             std::hash<GrainT>,
-            Traits<GrainT>::key_equal
+            typename Traits<GrainT>::key_equal
         >;
 
     // ----------------------------------------------------------------------
@@ -52,6 +59,25 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(GrainEstimatorAnnotation);
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \enum          UnseenGrainPolicy
+///  \brief         Determines how a `GrainTransformer` handles grains that
+///                 weren't seen during training.
+///
+enum class UnseenGrainPolicy : uint8_t {
+    Error = 1,                              ///< An exception is thrown
+    UseDefault,                             ///< All unseen grains share a default transformer trained on all of the data; appropriate for stateless transformers, as anything that it produces during flush is discarded
+    CloneDefault,                           ///< Each unseen grain gets its own copy of the default transformer
+
+    NumValues
+};
+
+inline bool IsValid(UnseenGrainPolicy value) {
+    return value == UnseenGrainPolicy::Error
+        || value == UnseenGrainPolicy::UseDefault
+        || value == UnseenGrainPolicy::CloneDefault;
+}
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         GrainEstimatorTraits
 ///  \brief         Traits common to all types of `Estimators` when used within
@@ -70,6 +96,20 @@ struct GrainEstimatorTraits {
 ///  \brief         A Transformer that applies a Transformer unique to the
 ///                 observed grain using grain-specific state.
 ///
+///                 Grains that weren't seen during training are handled
+///                 according to the `UnseenGrainPolicy`; when the default
+///                 transformer is cloned, the clone is deserialized from an
+///                 image of the default transformer created during
+///                 construction. Clones aren't trained Transformers, so they
+///                 aren't saved.
+///
+///                 The per-grain Transformers are archived as records sorted
+///                 by grain, preceded by a directory of fixed-size offsets.
+///                 When deserialized, a grain's Transformer is located with a
+///                 binary search of the directory and deserialized the first
+///                 time that the grain is encountered, so grains that are never
+///                 seen are never materialized.
+///
 template <typename GrainT, typename EstimatorT>
 class GrainTransformer :
     public Transformer<
@@ -97,15 +137,39 @@ public:
         >;
 
     using GrainTransformerTypeUniquePtr     = std::unique_ptr<GrainTransformerType>;
-    using TransformerMap                    = std::map<GrainT, GrainTransformerTypeUniquePtr>;
+    using TransformerMap =
+        std::unordered_map<
+            GrainT,
+            GrainTransformerTypeUniquePtr,
+            std::hash<GrainT>,
+            typename Traits<GrainT>::key_equal
+        >;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    GrainTransformer(TransformerMap transformers);
-    GrainTransformer(Archive &ar);
+    GrainTransformer(
+        TransformerMap transformers,
+        GrainTransformerTypeUniquePtr pDefaultTransformer=GrainTransformerTypeUniquePtr(),
+        UnseenGrainPolicy unseenGrainPolicy=UnseenGrainPolicy::Error
+    );
+
+    /// By default, the archived per-grain Transformers are copied so that they
+    /// can be deserialized after `ar` is destroyed. If `pBufferOwner` keeps the
+    /// buffer that `ar` reads from alive (for example, a memory mapped file), the
+    /// Transformers are deserialized directly from that buffer instead.
+    ///
+    /// When `maxResidentGrains` is not 0, the least recently used per-grain
+    /// Transformers are discarded once that many are resident and are
+    /// deserialized again when their grain is encountered; this is only
+    /// appropriate for Transformers that don't change state during `execute`.
+    GrainTransformer(
+        Archive &ar,
+        std::shared_ptr<void const> pBufferOwner=std::shared_ptr<void const>(),
+        size_t maxResidentGrains=0
+    );
 
     ~GrainTransformer(void) override = default;
 
@@ -113,38 +177,142 @@ public:
 
     void save(Archive &ar) const override;
 
+    /// Number of per-grain Transformers that have been materialized
+    size_t num_resident_grains(void) const;
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Archived per-grain Transformers that are deserialized on demand
+    struct GrainDirectory {
+        std::shared_ptr<void const>         pBufferOwner;
+        unsigned char const *               pOffsets;                       // `cGrains` serialized std::uint64_t values
+        unsigned char const *               pRecords;                       // Grain followed by its Transformer
+        std::uint64_t                       cGrains;
+        std::uint64_t                       cbRecords;
+
+        GrainDirectory(void);
+        GrainDirectory(std::shared_ptr<void const> pBufferOwner, unsigned char const *pOffsets, unsigned char const *pRecords, std::uint64_t cGrains, std::uint64_t cbRecords);
+
+        std::uint64_t get_offset(std::uint64_t index) const;
+
+        unsigned char const * get_record_begin(std::uint64_t index) const;
+        unsigned char const * get_record_end(std::uint64_t index) const;
+
+        GrainT get_grain(std::uint64_t index) const;
+    };
+
+    using ConstructorArgs                   = std::tuple<UnseenGrainPolicy, GrainTransformerTypeUniquePtr, GrainDirectory, size_t>;
+    using GrainSet                          = std::unordered_set<GrainT, std::hash<GrainT>, typename Traits<GrainT>::key_equal>;
+    using ClonedGrainSet                    = std::unordered_set<GrainT const *>;
+    using LruList                           = std::list<GrainT const *>;
+    using LruMap                            = std::unordered_map<GrainT const *, typename LruList::iterator>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    TransformerMap                          _transformers;
+    TransformerMap                          _transformers;                  // Resident Transformers
+    UnseenGrainPolicy const                 _unseenGrainPolicy;
+    GrainTransformerTypeUniquePtr           _pDefaultTransformer;
+    Archive::ByteArray                      _defaultTransformerImage;       // CloneDefault
+    GrainDirectory                          _directory;
+    GrainSet                                _unseenGrains;                  // UseDefault; grains known to not be in _directory
+    ClonedGrainSet                          _clonedGrains;                  // CloneDefault; resident Transformers cloned from the default Transformer
+
+    size_t const                            _maxResidentGrains;
+    LruList                                 _lru;                           // Most recently used first; only populated when _maxResidentGrains != 0
+    LruMap                                  _lruLookup;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    GrainTransformer(
+        TransformerMap transformers,
+        GrainTransformerTypeUniquePtr pDefaultTransformer,
+        UnseenGrainPolicy unseenGrainPolicy,
+        GrainDirectory directory,
+        size_t maxResidentGrains
+    );
+    GrainTransformer(ConstructorArgs args);
+
+    static ConstructorArgs Deserialize(Archive &ar, std::shared_ptr<void const> pBufferOwner, size_t maxResidentGrains);
+
+    /// Returns the index of the first directory record in [`lower`, `cGrains`)
+    /// whose grain is not less than `grain`
+    std::uint64_t lower_bound_record(GrainT const &grain, std::uint64_t lower) const;
+
+    /// Returns the index of the directory record for `grain`, or `cGrains` if
+    /// the grain isn't in the directory
+    std::uint64_t find_record(GrainT const &grain) const;
+
+    GrainTransformerType & add_resident(GrainT const &grain, GrainTransformerTypeUniquePtr pTransformer, bool isClone);
 
     // MSVC has problems when the declaration and definition are separated
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        GrainT const &                      grain(std::get<0>(input));
-        GrainTransformerType &              transformer(
-            [this, &grain](void) -> GrainTransformerType & {
+    GrainTransformerType & get_transformer(GrainT const &grain) {
+        typename TransformerMap::iterator const                             iter(_transformers.find(grain));
 
-                typename TransformerMap::iterator const                     iter(_transformers.find(grain));
+        if(iter != _transformers.end()) {
+            assert(iter->second);
 
-                if(iter == _transformers.end())
-                    throw std::runtime_error("Grain not found");
+            if(_maxResidentGrains != 0) {
+                typename LruList::iterator const                            lruIter(_lruLookup.at(&iter->first));
 
-                // TODO: Add support for a "default transformer" that (if provided during construction)
-                //       is cloned when a grain isn't found.
+                _lru.splice(_lru.begin(), _lru, lruIter);
+            }
 
-                assert(iter->second);
-                return *iter->second;
-            }()
-        );
+            return *iter->second;
+        }
+
+        // Unseen grains that share the default Transformer aren't resident, so
+        // remember them to avoid searching the directory for every row.
+        if(_unseenGrainPolicy == UnseenGrainPolicy::UseDefault && _unseenGrains.find(grain) != _unseenGrains.end())
+            return *_pDefaultTransformer;
+
+        std::uint64_t const                                                 recordIndex(find_record(grain));
+
+        if(recordIndex != _directory.cGrains) {
+            unsigned char const * const                                     pBegin(_directory.get_record_begin(recordIndex));
+            Archive                                                         archive(pBegin, static_cast<size_t>(_directory.get_record_end(recordIndex) - pBegin));
+
+            // Skip the grain
+            Traits<GrainT>::deserialize(archive);
+
+            return add_resident(grain, GrainTransformerTypeUniquePtr(new typename EstimatorT::TransformerType(archive)), false);
+        }
+
+        if(_unseenGrainPolicy == UnseenGrainPolicy::UseDefault) {
+            if(_directory.cGrains != 0) {
+                // Bound the memory used when resident grains are limited
+                if(_maxResidentGrains != 0 && _unseenGrains.size() >= _maxResidentGrains)
+                    _unseenGrains.clear();
+
+                _unseenGrains.emplace(grain);
+            }
+
+            return *_pDefaultTransformer;
+        }
+
+        if(_unseenGrainPolicy == UnseenGrainPolicy::CloneDefault) {
+            Archive                                                         archive(_defaultTransformerImage.data(), _defaultTransformerImage.size());
+
+            return add_resident(grain, GrainTransformerTypeUniquePtr(new typename EstimatorT::TransformerType(archive)), true);
+        }
+
+        throw std::runtime_error("Grain not found");
+    }
+
+    // MSVC has problems when the declaration and definition are separated
+    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        GrainT const &                      grain(std::get<0>(input));
+        GrainTransformerType &              transformer(get_transformer(grain));
 
         typename EstimatorT::InputType const &          grainInput(std::get<1>(input));
 
@@ -158,13 +326,42 @@ private:
 
     // MSVC has problems when the declaration and definition are separated
     void flush_impl(typename BaseType::CallbackFunction const &callback) override {
-        for(auto &kvp : _transformers) {
-            kvp.second->flush(
-                [&callback, &kvp](typename EstimatorT::TransformedType output) {
-                    callback(std::make_tuple(kvp.first, std::move(output)));
+        // Grains are flushed in order; grains that were never materialized don't
+        // have anything to flush.
+        for(typename TransformerMap::value_type *pKvp : get_sorted_transformers()) {
+            pKvp->second->flush(
+                [&callback, &pKvp](typename EstimatorT::TransformedType output) {
+                    callback(std::make_tuple(pKvp->first, std::move(output)));
                 }
             );
         }
+
+        // Output of the shared default transformer can't be associated with a
+        // specific grain (and labeling it with a default-constructed grain would
+        // be indistinguishable from a real grain), so it is discarded; the
+        // transformer is still flushed so that its state is reset.
+        if(_unseenGrainPolicy == UnseenGrainPolicy::UseDefault)
+            _pDefaultTransformer->flush([](typename EstimatorT::TransformedType) {});
+    }
+
+    // MSVC has problems when the declaration and definition are separated
+    std::vector<typename TransformerMap::value_type *> get_sorted_transformers(void) const {
+        std::vector<typename TransformerMap::value_type *>                  result;
+
+        result.reserve(_transformers.size());
+
+        for(auto const &kvp : _transformers)
+            result.emplace_back(const_cast<typename TransformerMap::value_type *>(&kvp));
+
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](typename TransformerMap::value_type const *pA, typename TransformerMap::value_type const *pB) {
+                return pA->first < pB->first;
+            }
+        );
+
+        return result;
     }
 };
 
@@ -175,6 +372,22 @@ namespace Impl {
 ///  \brief         Functionality common to GrainEstimators based on
 ///                 FitEstimator or TransformerEstimator objects.
 ///
+///                 Each buffer provided to `fit` is grouped by grain so that
+///                 every per-grain Estimator is fit with a single contiguous
+///                 buffer; the per-grain Estimators can optionally be fit on
+///                 multiple threads, in which case they must not share state
+///                 while fitting.
+///
+///                 The number of per-grain Estimators held in memory during
+///                 training can be capped for Estimators that can save and
+///                 restore their training state (see
+///                 `Details::HasTrainingStateMethods`); the least recently
+///                 updated Estimators are spilled to a scratch file and
+///                 restored when their grain is encountered again. When
+///                 training is completed, the spilled Estimators are restored
+///                 one at a time, and every per-grain Estimator is released
+///                 as soon as it has been completed.
+///
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
 class GrainEstimatorImplBase : public BaseT {
 public:
@@ -198,7 +411,24 @@ public:
     // |
     // ----------------------------------------------------------------------
     GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations);
-    GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc);
+    /// `unseenGrainPolicy` can only be something other than `Error` when the
+    /// Estimator creates Transformers; in that case, an additional Estimator
+    /// is trained on all of the data to create the default Transformer.
+    ///
+    /// `numTrainingThreads` is the number of threads used to fit distinct
+    /// grains (0 uses the hardware concurrency).
+    ///
+    /// `maxResidentEstimators` is the number of per-grain Estimators kept in
+    /// memory between calls to `fit` (0 for no limit); a single call to `fit`
+    /// may temporarily exceed it by the number of grains in its buffer.
+    GrainEstimatorImplBase(
+        char const *name,
+        AnnotationMapsPtr pAllColumnAnnotations,
+        CreateEstimatorFunc createFunc,
+        UnseenGrainPolicy unseenGrainPolicy=UnseenGrainPolicy::Error,
+        std::uint32_t numTrainingThreads=1,
+        size_t maxResidentEstimators=0
+    );
 
     ~GrainEstimatorImplBase(void) override = default;
 
@@ -210,7 +440,13 @@ protected:
     // |  Protected Types
     // |
     // ----------------------------------------------------------------------
-    using EstimatorMap                      = typename GrainEstimatorAnnotation<GrainT>::AnnotationMap;
+    using EstimatorMap =
+        std::unordered_map<
+            GrainT,
+            EstimatorT,
+            std::hash<GrainT>,
+            typename Traits<GrainT>::key_equal
+        >;
 
     // ----------------------------------------------------------------------
     // |
@@ -219,7 +455,46 @@ protected:
     // ----------------------------------------------------------------------
     EstimatorMap                            _estimators;
 
+    UnseenGrainPolicy const                 _unseenGrainPolicy;
+    std::unique_ptr<EstimatorT>             _pDefaultEstimator;             // Trained on all items when _unseenGrainPolicy != Error
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Protected Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Invoked during `complete_training` for each per-grain Estimator once it
+    /// has been completed; the Estimator is destroyed when this method returns.
+    virtual void on_estimator_completed(GrainT const &grain, EstimatorT &estimator);
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Location of an Estimator's training state in the scratch file; the
+    /// space is reused when the Estimator is spilled again.
+    struct SpillSlot {
+        std::uint64_t                       Offset;
+        std::uint64_t                       Capacity;
+        size_t                              Size;
+        bool                                IsSpilled;
+    };
+
+    using SpillSlotMap =
+        std::unordered_map<
+            GrainT,
+            SpillSlot,
+            std::hash<GrainT>,
+            typename Traits<GrainT>::key_equal
+        >;
+
+    using LruList                           = std::list<GrainT const *>;
+    using LruMap                            = std::unordered_map<GrainT const *, typename LruList::iterator>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
@@ -232,12 +507,34 @@ private:
     CreateEstimatorFunc const               _createFunc;
 
     size_t                                  _cRemainingTrainingItems;
+    std::uint32_t const                     _numTrainingThreads;
+
+    // Spilling (only used when _maxResidentEstimators != 0)
+    size_t const                            _maxResidentEstimators;
+    std::unique_ptr<ScratchFile>            _pScratchFile;                  // Created on the first spill
+    SpillSlotMap                            _spillSlots;
+    LruList                                 _lru;                           // Most recently updated first
+    LruMap                                  _lruLookup;
+    std::unordered_set<EstimatorT const *>  _finishedEstimators;            // Restored Estimators that had finished training
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    EstimatorT & get_estimator(GrainT const &grain);
+
+    void spill_estimators(void);
+
+    /// Restores the training state spilled to `slot` into an Estimator that has
+    /// begun training; returns false if the Estimator had finished training.
+    bool restore_estimator(EstimatorT &estimator, SpillSlot const &slot) const;
+
+    static void save_training_state(EstimatorT const &estimator, Archive &ar, std::true_type);
+    static void save_training_state(EstimatorT const &estimator, Archive &ar, std::false_type);
+    static void restore_training_state(EstimatorT &estimator, Archive &ar, std::true_type);
+    static void restore_training_state(EstimatorT &estimator, Archive &ar, std::false_type);
+
     bool begin_training_impl(void) override;
     FitResult fit_impl(InputType const *pItems, size_t cItems) override;
     void complete_training_impl(void) override;
@@ -350,18 +647,29 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(GrainEstimatorImpl);
 
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    typename TransformerType::TransformerMap            _transformers;      // Created as each per-grain Estimator is completed
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    void on_estimator_completed(GrainT const &grain, EstimatorT &estimator) override {
+        _transformers.emplace(std::make_pair(grain, estimator.create_transformer()));
+    }
+
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
-        typename TransformerType::TransformerMap        transformers;
+        typename TransformerType::GrainTransformerTypeUniquePtr     pDefaultTransformer;
 
-        for(auto & kvp: this->_estimators)
-            transformers.emplace(std::make_pair(kvp.first, kvp.second.create_transformer()));
+        if(this->_pDefaultEstimator)
+            pDefaultTransformer = this->_pDefaultEstimator->create_transformer();
 
-        return typename BaseType::TransformerUniquePtr(new TransformerType(std::move(transformers)));
+        return typename BaseType::TransformerUniquePtr(new TransformerType(std::move(_transformers), std::move(pDefaultTransformer), this->_unseenGrainPolicy));
     }
 };
 
@@ -423,53 +731,302 @@ GrainEstimatorAnnotation<GrainT>::GrainEstimatorAnnotation(AnnotationMap annotat
 // |
 // ----------------------------------------------------------------------
 template <typename GrainT, typename EstimatorT>
-GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers) :
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers, GrainTransformerTypeUniquePtr pDefaultTransformer, UnseenGrainPolicy unseenGrainPolicy) :
+    GrainTransformer(
+        std::move(transformers),
+        std::move(pDefaultTransformer),
+        std::move(unseenGrainPolicy),
+        GrainDirectory(),
+        0
+    ) {
+}
+
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar, std::shared_ptr<void const> pBufferOwner, size_t maxResidentGrains) :
+    GrainTransformer(Deserialize(ar, std::move(pBufferOwner), std::move(maxResidentGrains))) {
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::save(Archive &ar) const /*override*/ {
+    Traits<std::underlying_type<UnseenGrainPolicy>::type>::serialize(ar, static_cast<std::underlying_type<UnseenGrainPolicy>::type>(_unseenGrainPolicy));
+
+    if(_pDefaultTransformer)
+        _pDefaultTransformer->save(ar);
+
+    // Merge the resident Transformers with the directory records that haven't
+    // been materialized. The records between resident Transformers are copied
+    // as a block without decoding their grains; clones of the default
+    // Transformer aren't saved.
+    std::uint64_t                                                           recordIndex(0);
+    std::vector<std::uint64_t>                                              offsets;
+    Archive::ByteArray                                                      records;
+
+    offsets.reserve(static_cast<size_t>(_directory.cGrains) + _transformers.size() - _clonedGrains.size());
+
+    auto const                                                              copyRecordsFunc(
+        [this, &offsets, &records](std::uint64_t begin, std::uint64_t end) {
+            if(begin == end)
+                return;
+
+            std::uint64_t const             beginOffset(_directory.get_offset(begin));
+
+            for(std::uint64_t index = begin; index < end; ++index)
+                offsets.emplace_back(records.size() + (_directory.get_offset(index) - beginOffset));
+
+            records.insert(records.end(), _directory.get_record_begin(begin), _directory.get_record_end(end - 1));
+        }
+    );
+
+    for(typename TransformerMap::value_type const *pResident : get_sorted_transformers()) {
+        if(_clonedGrains.find(&pResident->first) != _clonedGrains.end())
+            continue;
+
+        std::uint64_t const                 position(lower_bound_record(pResident->first, recordIndex));
+
+        copyRecordsFunc(recordIndex, position);
+        recordIndex = position;
+
+        // The resident Transformer supersedes the record
+        if(recordIndex != _directory.cGrains && typename Traits<GrainT>::key_equal()(_directory.get_grain(recordIndex), pResident->first))
+            ++recordIndex;
+
+        Archive                             archive;
+
+        Traits<GrainT>::serialize(archive, pResident->first);
+        pResident->second->save(archive);
+
+        Archive::ByteArray const            record(archive.commit());
+
+        offsets.emplace_back(records.size());
+        records.insert(records.end(), record.begin(), record.end());
+    }
+
+    copyRecordsFunc(recordIndex, _directory.cGrains);
+
+    Traits<std::uint64_t>::serialize(ar, offsets.size());
+
+    for(std::uint64_t const &offset : offsets)
+        Traits<std::uint64_t>::serialize(ar, offset);
+
+    Traits<std::uint64_t>::serialize(ar, records.size());
+    ar.serialize(records.data(), records.size());
+}
+
+template <typename GrainT, typename EstimatorT>
+size_t GrainTransformer<GrainT, EstimatorT>::num_resident_grains(void) const {
+    return _transformers.size();
+}
+
+// ----------------------------------------------------------------------
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainDirectory::GrainDirectory(void) :
+    pOffsets(nullptr),
+    pRecords(nullptr),
+    cGrains(0),
+    cbRecords(0) {
+}
+
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainDirectory::GrainDirectory(std::shared_ptr<void const> pBufferOwnerParam, unsigned char const *pOffsetsParam, unsigned char const *pRecordsParam, std::uint64_t cGrainsParam, std::uint64_t cbRecordsParam) :
+    pBufferOwner(std::move(pBufferOwnerParam)),
+    pOffsets(pOffsetsParam),
+    pRecords(pRecordsParam),
+    cGrains(cGrainsParam),
+    cbRecords(cbRecordsParam) {
+}
+
+template <typename GrainT, typename EstimatorT>
+std::uint64_t GrainTransformer<GrainT, EstimatorT>::GrainDirectory::get_offset(std::uint64_t index) const {
+    assert(index < cGrains);
+
+    Archive                                 archive(pOffsets + index * sizeof(std::uint64_t), sizeof(std::uint64_t));
+
+    return Traits<std::uint64_t>::deserialize(archive);
+}
+
+template <typename GrainT, typename EstimatorT>
+unsigned char const * GrainTransformer<GrainT, EstimatorT>::GrainDirectory::get_record_begin(std::uint64_t index) const {
+    return pRecords + get_offset(index);
+}
+
+template <typename GrainT, typename EstimatorT>
+unsigned char const * GrainTransformer<GrainT, EstimatorT>::GrainDirectory::get_record_end(std::uint64_t index) const {
+    return pRecords + (index + 1 == cGrains ? cbRecords : get_offset(index + 1));
+}
+
+template <typename GrainT, typename EstimatorT>
+GrainT GrainTransformer<GrainT, EstimatorT>::GrainDirectory::get_grain(std::uint64_t index) const {
+    unsigned char const * const             pBegin(get_record_begin(index));
+    Archive                                 archive(pBegin, static_cast<size_t>(get_record_end(index) - pBegin));
+
+    return Traits<GrainT>::deserialize(archive);
+}
+
+// ----------------------------------------------------------------------
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers, GrainTransformerTypeUniquePtr pDefaultTransformer, UnseenGrainPolicy unseenGrainPolicy, GrainDirectory directory, size_t maxResidentGrains) :
     _transformers(
         std::move(
-            [&transformers](void) -> TransformerMap & {
-                if(transformers.empty())
+            [&transformers, &directory](void) -> TransformerMap & {
+                if(transformers.empty() && directory.cGrains == 0)
                     throw std::invalid_argument("transformers");
 
                 return transformers;
             }()
         )
-    ) {
+    ),
+    _unseenGrainPolicy(
+        [&unseenGrainPolicy, &pDefaultTransformer](void) {
+            if(IsValid(unseenGrainPolicy) == false)
+                throw std::invalid_argument("unseenGrainPolicy");
+
+            if((unseenGrainPolicy == UnseenGrainPolicy::Error) != (pDefaultTransformer == nullptr))
+                throw std::invalid_argument("pDefaultTransformer");
+
+            return unseenGrainPolicy;
+        }()
+    ),
+    _pDefaultTransformer(std::move(pDefaultTransformer)),
+    _defaultTransformerImage(
+        [this](void) {
+            if(_unseenGrainPolicy != UnseenGrainPolicy::CloneDefault)
+                return Archive::ByteArray();
+
+            Archive                         archive;
+
+            _pDefaultTransformer->save(archive);
+            return archive.commit();
+        }()
+    ),
+    _directory(std::move(directory)),
+    _maxResidentGrains(maxResidentGrains) {
 }
 
 template <typename GrainT, typename EstimatorT>
-GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar) :
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(ConstructorArgs args) :
     GrainTransformer(
-        [&ar](void) -> TransformerMap {
-            std::uint64_t                   cElements(Traits<std::uint64_t>::deserialize(ar));
+        TransformerMap(),
+        std::move(std::get<1>(args)),
+        std::get<0>(args),
+        std::move(std::get<2>(args)),
+        std::get<3>(args)
+    ) {
+}
 
-            if(cElements == 0)
-                throw std::runtime_error("Invalid elements");
+template <typename GrainT, typename EstimatorT>
+/*static*/ typename GrainTransformer<GrainT, EstimatorT>::ConstructorArgs GrainTransformer<GrainT, EstimatorT>::Deserialize(Archive &ar, std::shared_ptr<void const> pBufferOwner, size_t maxResidentGrains) {
+    UnseenGrainPolicy const                 unseenGrainPolicy(static_cast<UnseenGrainPolicy>(Traits<std::underlying_type<UnseenGrainPolicy>::type>::deserialize(ar)));
 
-            TransformerMap                  transformers;
+    if(IsValid(unseenGrainPolicy) == false)
+        throw std::runtime_error("Invalid unseen grain policy");
 
-            while(cElements--) {
-                GrainT                                  grain(Traits<GrainT>::deserialize(ar));
-                GrainTransformerTypeUniquePtr           pTransformer(new typename EstimatorT::TransformerType(ar));
+    GrainTransformerTypeUniquePtr           pDefaultTransformer;
 
-                std::pair<typename TransformerMap::iterator, bool> const    result(transformers.emplace(std::make_pair(std::move(grain), std::move(pTransformer))));
+    if(unseenGrainPolicy != UnseenGrainPolicy::Error)
+        pDefaultTransformer.reset(new typename EstimatorT::TransformerType(ar));
 
-                if(result.first == transformers.end() || result.second == false)
-                    throw std::runtime_error("Invalid insertion");
-            }
+    std::uint64_t const                     cGrains(Traits<std::uint64_t>::deserialize(ar));
 
-            return transformers;
-        }()
-    ) {
+    if(cGrains == 0 || cGrains > std::numeric_limits<size_t>::max() / sizeof(std::uint64_t))
+        throw std::runtime_error("Invalid elements");
+
+    unsigned char const *                   pOffsets(ar.get_buffer_ptr());
+
+    ar.update_buffer_ptr(static_cast<size_t>(cGrains * sizeof(std::uint64_t)));
+
+    std::uint64_t const                     cbRecords(Traits<std::uint64_t>::deserialize(ar));
+    unsigned char const *                   pRecords(ar.get_buffer_ptr());
+
+    ar.update_buffer_ptr(static_cast<size_t>(cbRecords));
+
+    // Keep a copy of the directory if the caller isn't keeping the buffer alive
+    if(!pBufferOwner) {
+        std::shared_ptr<Archive::ByteArray> pBuffer(std::make_shared<Archive::ByteArray>(pOffsets, pRecords + cbRecords));
+
+        pRecords = pBuffer->data() + (pRecords - pOffsets);
+        pOffsets = pBuffer->data();
+        pBufferOwner = std::move(pBuffer);
+    }
+
+    GrainDirectory                          directory(std::move(pBufferOwner), pOffsets, pRecords, cGrains, cbRecords);
+
+    // Records must be non-empty and in order
+    for(std::uint64_t index = 0; index < cGrains; ++index) {
+        std::uint64_t const                 offset(directory.get_offset(index));
+
+        if(offset >= cbRecords || (index == 0 ? offset != 0 : offset <= directory.get_offset(index - 1)))
+            throw std::runtime_error("Invalid offsets");
+    }
+
+    // `find_record` binary searches the records, so their grains must be
+    // unique and sorted. Only the grains are decoded here; the Transformers
+    // are deserialized on demand.
+    GrainT                                  prevGrain(directory.get_grain(0));
+
+    for(std::uint64_t index = 1; index < cGrains; ++index) {
+        GrainT                              grain(directory.get_grain(index));
+
+        if((prevGrain < grain) == false)
+            throw std::runtime_error("Invalid grain order");
+
+        prevGrain = std::move(grain);
+    }
+
+    return ConstructorArgs(unseenGrainPolicy, std::move(pDefaultTransformer), std::move(directory), maxResidentGrains);
 }
 
 template <typename GrainT, typename EstimatorT>
-void GrainTransformer<GrainT, EstimatorT>::save(Archive &ar) const /*override*/ {
-    Traits<std::uint64_t>::serialize(ar, _transformers.size());
+std::uint64_t GrainTransformer<GrainT, EstimatorT>::lower_bound_record(GrainT const &grain, std::uint64_t lower) const {
+    std::uint64_t                           upper(_directory.cGrains);
+
+    while(lower < upper) {
+        std::uint64_t const                 index(lower + (upper - lower) / 2);
+
+        if(_directory.get_grain(index) < grain)
+            lower = index + 1;
+        else
+            upper = index;
+    }
+
+    return lower;
+}
+
+template <typename GrainT, typename EstimatorT>
+std::uint64_t GrainTransformer<GrainT, EstimatorT>::find_record(GrainT const &grain) const {
+    std::uint64_t const                     index(lower_bound_record(grain, 0));
+
+    if(index != _directory.cGrains && (grain < _directory.get_grain(index)) == false)
+        return index;
+
+    return _directory.cGrains;
+}
+
+template <typename GrainT, typename EstimatorT>
+typename GrainTransformer<GrainT, EstimatorT>::GrainTransformerType & GrainTransformer<GrainT, EstimatorT>::add_resident(GrainT const &grain, GrainTransformerTypeUniquePtr pTransformer, bool isClone) {
+    std::pair<typename TransformerMap::iterator, bool> const                result(_transformers.emplace(grain, std::move(pTransformer)));
+
+    assert(result.second);
 
-    for(auto const &kvp: _transformers) {
-        Traits<GrainT>::serialize(ar, kvp.first);
-        kvp.second->save(ar);
+    if(isClone)
+        _clonedGrains.emplace(&result.first->first);
+
+    if(_maxResidentGrains != 0) {
+        _lru.emplace_front(&result.first->first);
+        _lruLookup.emplace(&result.first->first, _lru.begin());
+
+        // Evict the least recently used Transformers; the new Transformer is at
+        // the front of the list and is never evicted.
+        while(_transformers.size() > _maxResidentGrains) {
+            GrainT const * const            pGrain(_lru.back());
+
+            _lru.pop_back();
+            _lruLookup.erase(pGrain);
+            _clonedGrains.erase(pGrain);
+            _transformers.erase(_transformers.find(*pGrain));
+        }
     }
+
+    return *result.first->second;
 }
 
 // ----------------------------------------------------------------------
@@ -489,8 +1046,20 @@ Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::G
 }
 
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
-Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc) :
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc, UnseenGrainPolicy unseenGrainPolicy, std::uint32_t numTrainingThreads, size_t maxResidentEstimators) :
     BaseT(name, pAllColumnAnnotations),
+    _unseenGrainPolicy(
+        [&unseenGrainPolicy](void) {
+            if(IsValid(unseenGrainPolicy) == false)
+                throw std::invalid_argument("unseenGrainPolicy");
+
+            // Default transformers only apply to Estimators that create Transformers
+            if(unseenGrainPolicy != UnseenGrainPolicy::Error && Details::IsTransformerEstimator<EstimatorT>::value == false)
+                throw std::invalid_argument("unseenGrainPolicy");
+
+            return unseenGrainPolicy;
+        }()
+    ),
     _pAllColumnAnnotations(pAllColumnAnnotations),
     _createFunc(
         std::move(
@@ -502,14 +1071,143 @@ Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::G
             }()
         )
     ),
-    _cRemainingTrainingItems(MaxNumTrainingItemsV) {
+    _cRemainingTrainingItems(MaxNumTrainingItemsV),
+    _numTrainingThreads(numTrainingThreads),
+    _maxResidentEstimators(
+        [&maxResidentEstimators](void) {
+            if(maxResidentEstimators != 0 && Details::HasTrainingStateMethods<EstimatorT>::value == false)
+                throw std::invalid_argument("maxResidentEstimators");
+
+            return maxResidentEstimators;
+        }()
+    ) {
 }
 
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::on_estimator_completed(GrainT const &, EstimatorT &) {
+    // Nothing to do here
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+EstimatorT & Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::get_estimator(GrainT const &grain) {
+    typename EstimatorMap::iterator const   iter(_estimators.find(grain));
+
+    if(iter != _estimators.end()) {
+        if(_maxResidentEstimators != 0)
+            _lru.splice(_lru.begin(), _lru, _lruLookup.at(&iter->first));
+
+        return iter->second;
+    }
+
+    std::pair<typename EstimatorMap::iterator, bool> const                  result(_estimators.emplace(std::make_pair(grain, _createFunc(_pAllColumnAnnotations))));
+    EstimatorT &                                                            estimator(result.first->second);
+
+    estimator.begin_training();
+
+    if(_maxResidentEstimators != 0) {
+        _lru.emplace_front(&result.first->first);
+        _lruLookup.emplace(&result.first->first, _lru.begin());
+
+        // Restore the training state if the Estimator was spilled
+        typename SpillSlotMap::iterator const                               iterSlot(_spillSlots.find(grain));
+
+        if(iterSlot != _spillSlots.end() && iterSlot->second.IsSpilled) {
+            if(restore_estimator(estimator, iterSlot->second) == false)
+                _finishedEstimators.emplace(&estimator);
+
+            iterSlot->second.IsSpilled = false;
+        }
+    }
+
+    return estimator;
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::spill_estimators(void) {
+    while(_estimators.size() > _maxResidentEstimators) {
+        GrainT const &                      grain(*_lru.back());
+        typename EstimatorMap::iterator     iter(_estimators.find(grain));
+
+        assert(iter != _estimators.end());
+
+        Archive                             archive;
+
+        Traits<bool>::serialize(archive, iter->second.get_state() == TrainingState::Training && _finishedEstimators.find(&iter->second) == _finishedEstimators.end());
+        save_training_state(iter->second, archive, std::integral_constant<bool, Details::HasTrainingStateMethods<EstimatorT>::value>());
+
+        Archive::ByteArray const            data(archive.commit());
+
+        if(!_pScratchFile)
+            _pScratchFile.reset(new ScratchFile());
+
+        typename SpillSlotMap::iterator     iterSlot(_spillSlots.find(grain));
+
+        if(iterSlot == _spillSlots.end())
+            iterSlot = _spillSlots.emplace(grain, SpillSlot{0, 0, 0, false}).first;
+
+        SpillSlot &                         slot(iterSlot->second);
+
+        if(data.size() <= slot.Capacity)
+            _pScratchFile->write(slot.Offset, data.data(), data.size());
+        else {
+            slot.Offset = _pScratchFile->append(data.data(), data.size());
+            slot.Capacity = data.size();
+        }
+
+        slot.Size = data.size();
+        slot.IsSpilled = true;
+
+        _finishedEstimators.erase(&iter->second);
+        _lruLookup.erase(&iter->first);
+        _lru.pop_back();
+        _estimators.erase(iter);
+    }
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+bool Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::restore_estimator(EstimatorT &estimator, SpillSlot const &slot) const {
+    assert(slot.IsSpilled);
+
+    Archive                                 archive(_pScratchFile->read(slot.Offset, slot.Size));
+    bool const                              isTraining(Traits<bool>::deserialize(archive));
+
+    restore_training_state(estimator, archive, std::integral_constant<bool, Details::HasTrainingStateMethods<EstimatorT>::value>());
+    return isTraining;
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::save_training_state(EstimatorT const &estimator, Archive &ar, std::true_type) {
+    estimator.save_training_state(ar);
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::save_training_state(EstimatorT const &, Archive &, std::false_type) {
+    throw std::runtime_error("The Estimator's training state can not be saved");
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::restore_training_state(EstimatorT &estimator, Archive &ar, std::true_type) {
+    estimator.restore_training_state(ar);
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::restore_training_state(EstimatorT &, Archive &, std::false_type) {
+    throw std::runtime_error("The Estimator's training state can not be restored");
+}
+
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
 bool Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::begin_training_impl(void) /*override*/ {
+    if(_unseenGrainPolicy != UnseenGrainPolicy::Error) {
+        _pDefaultEstimator.reset(new EstimatorT(_createFunc(_pAllColumnAnnotations)));
+        _pDefaultEstimator->begin_training();
+    }
+
     return _cRemainingTrainingItems != 0;
 }
 
@@ -518,37 +1216,113 @@ FitResult Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTraining
     size_t const                            cRemainingItems(std::min(_cRemainingTrainingItems, cItems));
     InputType const * const                 pEndItems(pItems + cRemainingItems);
 
-    while(pItems != pEndItems) {
-        EstimatorT &                        estimator(
-            [this, pItems](void) -> EstimatorT & {
-                GrainT const &                          grain(std::get<0>(*pItems));
-                typename EstimatorMap::iterator const   iter(_estimators.find(grain));
+    // Assign batch-local ids to the grains in order of their first appearance. Consecutive
+    // items frequently belong to the same grain, so the estimator is only looked up when the
+    // grain changes.
+    std::vector<EstimatorT *>                                           estimators;
+    std::unordered_map<EstimatorT const *, GrainInterner::IdType>      estimatorIds;
+    std::vector<GrainInterner::IdType>                                  itemIds;
+    GrainInterner::IdType                                               id(0);
+    bool                                                                isGrouped(true);
 
-                if(iter != _estimators.end())
-                    return iter->second;
+    itemIds.reserve(cRemainingItems);
 
-                std::pair<typename EstimatorMap::iterator, bool> const      result(_estimators.emplace(std::make_pair(grain, _createFunc(_pAllColumnAnnotations))));
+    for(InputType const *pItem = pItems; pItem != pEndItems; ++pItem) {
+        GrainT const &                      grain(std::get<0>(*pItem));
 
-                result.first->second.begin_training();
+        if(pItem == pItems || typename Traits<GrainT>::key_equal()(grain, std::get<0>(*(pItem - 1))) == false) {
+            EstimatorT &                    estimator(get_estimator(grain));
+            auto const                      result(estimatorIds.emplace(&estimator, static_cast<GrainInterner::IdType>(estimators.size())));
 
-                return result.first->second;
-            }()
-        );
+            if(result.second)
+                estimators.emplace_back(&estimator);
+            else
+                isGrouped = false;
+
+            id = result.first->second;
+        }
+
+        itemIds.emplace_back(id);
+    }
 
-        if(estimator.get_state() == TrainingState::Training) {
-            typename EstimatorT::InputType const &      input(std::get<1>(*pItems));
-            FitResult const                             result(estimator.fit(input));
+    // Copy the inputs so that the items of each grain are contiguous. When the items of each
+    // grain are already contiguous, the inputs are copied in order and each run of a grain is a
+    // partition.
+    GrainPartitions const                   partitions(
+        [&itemIds, &isGrouped, &cRemainingItems](void) -> GrainPartitions {
+            if(isGrouped == false) {
+                return PartitionByGrain(
+                    cRemainingItems,
+                    [&itemIds](size_t index) {
+                        return itemIds[index];
+                    }
+                );
+            }
+
+            GrainPartitions                 result;
+
+            for(size_t index = 0; index < cRemainingItems; ++index) {
+                if(index == 0 || itemIds[index] != itemIds[index - 1]) {
+                    result.GrainIds.emplace_back(itemIds[index]);
+                    result.Offsets.emplace_back(index);
+                }
+            }
+
+            result.Offsets.emplace_back(cRemainingItems);
+            return result;
+        }()
+    );
+
+    std::vector<typename EstimatorT::InputType>         inputs;
+
+    inputs.reserve(cRemainingItems);
+
+    if(isGrouped) {
+        for(InputType const *pItem = pItems; pItem != pEndItems; ++pItem)
+            inputs.emplace_back(std::get<1>(*pItem));
+    }
+    else {
+        for(size_t index : partitions.RowIndexes)
+            inputs.emplace_back(std::get<1>(pItems[index]));
+    }
+
+    ParallelForEach(
+        partitions.size(),
+        _numTrainingThreads,
+        [this, &estimators, &partitions, &inputs](size_t partition) {
+            EstimatorT &                    estimator(*estimators[partitions.GrainIds[partition]]);
+
+            if(estimator.get_state() != TrainingState::Training || _finishedEstimators.find(&estimator) != _finishedEstimators.end())
+                return;
+
+            size_t const                    offset(partitions.Offsets[partition]);
 
             // Don't allow resetting, as we don't have a good way to reset all of the estimators associated with
             // each of the unique grains.
-
-            if(result == FitResult::Reset)
+            if(estimator.fit(inputs.data() + offset, partitions.Offsets[partition + 1] - offset) == FitResult::Reset)
                 throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
         }
+    );
 
-        ++pItems;
+    // The default estimator sees the items in their original order, which is the order of
+    // `inputs` when the batch was already grouped; otherwise, it is fit with the original items
+    // rather than another copy of them.
+    if(_pDefaultEstimator && _pDefaultEstimator->get_state() == TrainingState::Training && cRemainingItems != 0) {
+        if(isGrouped) {
+            if(_pDefaultEstimator->fit(inputs.data(), inputs.size()) == FitResult::Reset)
+                throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
+        }
+        else {
+            for(InputType const *pItem = pItems; pItem != pEndItems && _pDefaultEstimator->get_state() == TrainingState::Training; ++pItem) {
+                if(_pDefaultEstimator->fit(std::get<1>(*pItem)) == FitResult::Reset)
+                    throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
+            }
+        }
     }
 
+    if(_maxResidentEstimators != 0)
+        spill_estimators();
+
     _cRemainingTrainingItems -= cRemainingItems;
     return _cRemainingTrainingItems ? FitResult::Continue : FitResult::Complete;
 }
@@ -593,50 +1367,90 @@ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItems
     ThisAnnotationMap                       newAnnotations;
     size_t                                  colIndex(0);
 
-    for(auto & kvp : _estimators) {
-        kvp.second.complete_training();
+    auto const                              completeFunc(
+        [this, &sizes, &newAnnotations, &colIndex](GrainT const &grain, EstimatorT &estimator) {
+            estimator.complete_training();
 
-        bool                                addedNewAnnotation(false);
+            bool                                addedNewAnnotation(false);
 
-        for(size_t i = 0; i < _pAllColumnAnnotations->size(); ++i) {
-            assert(_pAllColumnAnnotations->size() == sizes.size());
-            assert(i < _pAllColumnAnnotations->size());
+            for(size_t i = 0; i < _pAllColumnAnnotations->size(); ++i) {
+                assert(_pAllColumnAnnotations->size() == sizes.size());
+                assert(i < _pAllColumnAnnotations->size());
 
-            AnnotationMap &                 map((*_pAllColumnAnnotations)[i]);
-            size_t const &                  size(sizes[i]);
+                AnnotationMap &                 map((*_pAllColumnAnnotations)[i]);
+                size_t const &                  size(sizes[i]);
 
-            if(map.size() != size) {
-                assert(map.size() == size + 1);
+                if(map.size() != size) {
+                    assert(map.size() == size + 1);
 
-                if(addedNewAnnotation)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
+                    if(addedNewAnnotation)
+                        throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
 
-                if(newAnnotations.empty() == false && colIndex != i)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
+                    if(newAnnotations.empty() == false && colIndex != i)
+                        throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
 
-                colIndex = i;
+                    colIndex = i;
 
-                // If here, something was added. We expect that Annotation to be associated with the grain-based Estimator.
-                AnnotationMap::iterator     iter(map.find(kvp.second.Name));
+                    // If here, something was added. We expect that Annotation to be associated with the grain-based Estimator.
+                    AnnotationMap::iterator     iter(map.find(estimator.Name));
 
-                if(iter == map.end())
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
+                    if(iter == map.end())
+                        throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
 
-                // There should be only one entry
-                if(iter->second.size() != 1)
-                    throw std::runtime_error("Unexpected AnnotationMap size");
+                    // There should be only one entry
+                    if(iter->second.size() != 1)
+                        throw std::runtime_error("Unexpected AnnotationMap size");
 
-                // Insert this value into our working map
-                std::pair<typename ThisAnnotationMap::iterator, bool> const     result(newAnnotations.emplace(std::make_pair(kvp.first, std::move(iter->second[0]))));
+                    // Insert this value into our working map
+                    std::pair<typename ThisAnnotationMap::iterator, bool> const     result(newAnnotations.emplace(std::make_pair(grain, std::move(iter->second[0]))));
 
-                if(result.first == newAnnotations.end() || result.second == false)
-                    throw std::runtime_error("Invalid AnnotationMap insertion");
+                    if(result.first == newAnnotations.end() || result.second == false)
+                        throw std::runtime_error("Invalid AnnotationMap insertion");
 
-                addedNewAnnotation = true;
+                    addedNewAnnotation = true;
 
-                // Remove the value from the global map (which should restore the original sizes)
-                map.erase(iter);
+                    // Remove the value from the global map (which should restore the original sizes)
+                    map.erase(iter);
+                }
             }
+
+            on_estimator_completed(grain, estimator);
+        }
+    );
+
+    // Complete the resident Estimators, releasing each one once it is completed
+    for(typename EstimatorMap::iterator iter = _estimators.begin(); iter != _estimators.end(); iter = _estimators.erase(iter))
+        completeFunc(iter->first, iter->second);
+
+    // Restore and complete the spilled Estimators one at a time
+    for(auto const &kvp : _spillSlots) {
+        if(kvp.second.IsSpilled == false)
+            continue;
+
+        EstimatorT                          estimator(_createFunc(_pAllColumnAnnotations));
+
+        estimator.begin_training();
+        restore_estimator(estimator, kvp.second);
+
+        completeFunc(kvp.first, estimator);
+    }
+
+    _pScratchFile.reset();
+    _spillSlots.clear();
+    _lru.clear();
+    _lruLookup.clear();
+    _finishedEstimators.clear();
+
+    if(_pDefaultEstimator) {
+        _pDefaultEstimator->complete_training();
+
+        // Annotations created by the default Estimator aren't associated with a
+        // grain, so they are discarded.
+        for(size_t i = 0; i < _pAllColumnAnnotations->size(); ++i) {
+            AnnotationMap &                 map((*_pAllColumnAnnotations)[i]);
+
+            if(map.size() != sizes[i])
+                map.erase(_pDefaultEstimator->Name);
         }
     }
 
@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        GrainHash
+///  \brief         Hashes all the strings of a grain.
+///
+struct GrainHash {
+    size_t operator()(std::vector<std::string> const &grain) const;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         GrainInterner
+///  \brief         Assigns dense ids (0..N) to grains in the order that they are
+///                 first seen, so that per-grain state can be stored in arrays
+///                 indexed by id rather than in maps keyed by the grain itself.
+///                 Each lookup hashes the grain once; the grain is only copied
+///                 the first time it is seen.
+///
+class GrainInterner {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using GrainType                         = std::vector<std::string>;
+    using IdType                            = std::uint32_t;
+
+    static constexpr IdType const           InvalidId = std::numeric_limits<IdType>::max();
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    GrainInterner(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(GrainInterner);
+
+    /// Returns the id of the grain, assigning a new one if the grain hasn't been seen before
+    IdType intern(GrainType const &grain);
+
+    /// Returns the id of the grain or `InvalidId` if the grain hasn't been seen before
+    IdType find(GrainType const &grain) const;
+
+    GrainType const & get(IdType id) const;
+
+    size_t size(void) const;
+
+    /// Returns the ids ordered by grain, which is the order produced by a
+    /// `std::map` keyed by the grains
+    std::vector<IdType> sorted_ids(void) const;
+
+    void clear(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // Nodes in an unordered_map are never relocated, so _grains can point to
+    // the keys of _ids.
+    std::unordered_map<GrainType, IdType, GrainHash>    _ids;
+    std::vector<GrainType const *>                      _grains;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  GrainHash
+// |
+// ----------------------------------------------------------------------
+inline size_t GrainHash::operator()(std::vector<std::string> const &grain) const {
+    std::hash<std::string> const            hasher;
+    size_t                                  result(grain.size());
+
+    for(auto const &value : grain)
+        result ^= hasher(value) + 0x9e3779b9 + (result << 6) + (result >> 2);
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  GrainInterner
+// |
+// ----------------------------------------------------------------------
+inline GrainInterner::IdType GrainInterner::intern(GrainType const &grain) {
+    std::unordered_map<GrainType, IdType, GrainHash>::const_iterator const  iter(_ids.find(grain));
+
+    if(iter != _ids.end())
+        return iter->second;
+
+    if(_grains.size() >= InvalidId)
+        throw std::runtime_error("Too many grains");
+
+    IdType const                            id(static_cast<IdType>(_grains.size()));
+
+    _grains.emplace_back(&_ids.emplace(grain, id).first->first);
+    return id;
+}
+
+inline GrainInterner::IdType GrainInterner::find(GrainType const &grain) const {
+    std::unordered_map<GrainType, IdType, GrainHash>::const_iterator const  iter(_ids.find(grain));
+
+    if(iter == _ids.end())
+        return InvalidId;
+
+    return iter->second;
+}
+
+inline GrainInterner::GrainType const & GrainInterner::get(IdType id) const {
+    if(id >= _grains.size())
+        throw std::invalid_argument("id");
+
+    return *_grains[id];
+}
+
+inline size_t GrainInterner::size(void) const {
+    return _grains.size();
+}
+
+inline std::vector<GrainInterner::IdType> GrainInterner::sorted_ids(void) const {
+    std::vector<IdType>                     result;
+
+    result.reserve(_grains.size());
+
+    for(IdType id = 0; id < _grains.size(); ++id)
+        result.emplace_back(id);
+
+    std::sort(
+        result.begin(),
+        result.end(),
+        [this](IdType a, IdType b) {
+            return *_grains[a] < *_grains[b];
+        }
+    );
+
+    return result;
+}
+
+inline void GrainInterner::clear(void) {
+    _grains.clear();
+    _ids.clear();
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
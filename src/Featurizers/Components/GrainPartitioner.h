@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "GrainInterner.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        GrainPartitions
+///  \brief         The rows of a batch grouped by grain. Partitions are
+///                 ordered by the first appearance of their grain in the
+///                 batch, and the rows within a partition keep their order
+///                 in the batch.
+///
+struct GrainPartitions {
+    std::vector<GrainInterner::IdType>      GrainIds;                       ///< Grain of each partition
+    std::vector<size_t>                     Offsets;                        ///< The rows of partition `p` are RowIndexes[Offsets[p]..Offsets[p + 1])
+    std::vector<size_t>                     RowIndexes;
+
+    size_t size(void) const;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            PartitionByGrain
+///  \brief         Groups the rows [0..cRows) by the grain id returned by
+///                 `getGrainIdFunc(row)`.
+///
+template <typename GetGrainIdFuncT>
+GrainPartitions PartitionByGrain(size_t cRows, GetGrainIdFuncT const &getGrainIdFunc);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ParallelForEach
+///  \brief         Invokes `func(index)` for each index in [0..cItems) on up to
+///                 `numThreads` threads (0 uses the hardware concurrency).
+///                 Indexes are handed out dynamically, so items of varying
+///                 cost are balanced across the threads. If any invocation
+///                 throws, the remaining items are skipped and the exception
+///                 of the lowest failing index is rethrown on the calling
+///                 thread.
+///
+void ParallelForEach(size_t cItems, std::uint32_t numThreads, std::function<void (size_t)> const &func);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  GrainPartitions
+// |
+// ----------------------------------------------------------------------
+inline size_t GrainPartitions::size(void) const {
+    return GrainIds.size();
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Functions
+// |
+// ----------------------------------------------------------------------
+template <typename GetGrainIdFuncT>
+GrainPartitions PartitionByGrain(size_t cRows, GetGrainIdFuncT const &getGrainIdFunc) {
+    GrainPartitions                                         result;
+    std::unordered_map<GrainInterner::IdType, size_t>       partitionLookup;
+    std::vector<size_t>                                     rowPartitions;
+
+    rowPartitions.reserve(cRows);
+
+    for(size_t row = 0; row < cRows; ++row) {
+        GrainInterner::IdType const         grainId(getGrainIdFunc(row));
+        auto const                          insertResult(partitionLookup.emplace(grainId, result.GrainIds.size()));
+
+        if(insertResult.second) {
+            result.GrainIds.emplace_back(grainId);
+            result.Offsets.emplace_back(0);
+        }
+
+        size_t const                        partition(insertResult.first->second);
+
+        rowPartitions.emplace_back(partition);
+        ++result.Offsets[partition];
+    }
+
+    // Convert the counts into offsets
+    size_t                                  offset(0);
+
+    for(size_t &value : result.Offsets) {
+        size_t const                        count(value);
+
+        value = offset;
+        offset += count;
+    }
+
+    result.Offsets.emplace_back(offset);
+
+    // Counting sort, which keeps the rows of each partition in order
+    std::vector<size_t>                     positions(result.Offsets.begin(), result.Offsets.end() - 1);
+
+    result.RowIndexes.resize(cRows);
+
+    for(size_t row = 0; row < cRows; ++row)
+        result.RowIndexes[positions[rowPartitions[row]]++] = row;
+
+    return result;
+}
+
+inline void ParallelForEach(size_t cItems, std::uint32_t numThreads, std::function<void (size_t)> const &func) {
+    if(!func)
+        throw std::invalid_argument("func");
+
+    if(numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t const                            cThreads(std::min(static_cast<size_t>(numThreads), cItems));
+
+    if(cThreads <= 1) {
+        for(size_t index = 0; index < cItems; ++index)
+            func(index);
+
+        return;
+    }
+
+    std::atomic<size_t>                     nextIndex(0);
+    std::atomic<bool>                       failed(false);
+    std::vector<std::exception_ptr>         exceptions(cThreads);
+    std::vector<size_t>                     exceptionIndexes(cThreads, cItems);
+
+    auto const                              worker(
+        [&](size_t thread) {
+            while(failed.load() == false) {
+                size_t const                index(nextIndex++);
+
+                if(index >= cItems)
+                    break;
+
+                try {
+                    func(index);
+                }
+                catch(...) {
+                    exceptions[thread] = std::current_exception();
+                    exceptionIndexes[thread] = index;
+                    failed = true;
+                }
+            }
+        }
+    );
+
+    std::vector<std::thread>                threads;
+
+    threads.reserve(cThreads - 1);
+
+    try {
+        for(size_t thread = 1; thread < cThreads; ++thread)
+            threads.emplace_back(worker, thread);
+    }
+    catch(...) {
+        // The threads that were started must be joined before they are
+        // destroyed (std::thread's destructor terminates otherwise)
+        failed = true;
+
+        for(auto &thread : threads)
+            thread.join();
+
+        throw;
+    }
+
+    worker(0);
+
+    for(auto &thread : threads)
+        thread.join();
+
+    if(failed) {
+        size_t const                        thread(
+            static_cast<size_t>(
+                std::min_element(exceptionIndexes.begin(), exceptionIndexes.end()) - exceptionIndexes.begin()
+            )
+        );
+
+        std::rethrow_exception(exceptions[thread]);
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
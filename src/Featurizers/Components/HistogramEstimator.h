@@ -79,6 +79,9 @@ public:
     void fit(InputType const &input);
     HistogramAnnotationData<T> complete_training(void);
 
+    void save_training_state(Archive &ar) const;
+    void restore_training_state(Archive &ar);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -157,6 +160,16 @@ HistogramAnnotationData<T> Details::HistogramTrainingOnlyPolicy<T>::complete_tra
     return HistogramAnnotationData<T>(std::move(_histogram));
 }
 
+template <typename T>
+void Details::HistogramTrainingOnlyPolicy<T>::save_training_state(Archive &ar) const {
+    Traits<Histogram>::serialize(ar, _histogram);
+}
+
+template <typename T>
+void Details::HistogramTrainingOnlyPolicy<T>::restore_training_state(Archive &ar) {
+    _histogram = Traits<Histogram>::deserialize(ar);
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -6,6 +6,7 @@
 
 #include <unordered_map>
 
+#include "CompactStringIndexMap.h"
 #include "HistogramEstimator.h"
 
 namespace Microsoft {
@@ -53,6 +54,39 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(IndexMapAnnotationData);
 };
 
+namespace Details {
+
+template <typename T>
+struct CompactIndexMapSelector {
+    using type                              = typename IndexMapAnnotationData<T>::IndexMap;
+};
+
+template <>
+struct CompactIndexMapSelector<std::string> {
+    using type                              = CompactStringIndexMap;
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       CompactIndexMap
+///  \brief         Immutable IndexMap used by transformers once training is
+///                 complete; strings are stored in a `CompactStringIndexMap`
+///                 while all other types continue to use `IndexMap`.
+///
+template <typename T>
+using CompactIndexMap                       = typename Details::CompactIndexMapSelector<T>::type;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            FindIndex
+///  \brief         Returns a pointer to the index associated with the key or
+///                 nullptr if the key doesn't exist.
+///
+template <typename MapT, typename KeyT>
+std::uint32_t const * FindIndex(MapT const &map, KeyT const &key);
+
+inline std::uint32_t const * FindIndex(CompactStringIndexMap const &map, std::string const &key);
+
 template <typename T> typename IndexMapAnnotationData<T>::IndexMap CreateIndexMap(typename HistogramAnnotationData<T>::Histogram const &histogram, typename IndexMapAnnotationData<T>::IndexMap existingValues);
 
 namespace Details {
@@ -154,6 +188,20 @@ public:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+template <typename MapT, typename KeyT>
+std::uint32_t const * FindIndex(MapT const &map, KeyT const &key) {
+    typename MapT::const_iterator const     iter(map.find(key));
+
+    if(iter == map.end())
+        return nullptr;
+
+    return &iter->second;
+}
+
+inline std::uint32_t const * FindIndex(CompactStringIndexMap const &map, std::string const &key) {
+    return map.find(key);
+}
+
 template <typename T>
 typename IndexMapAnnotationData<T>::IndexMap CreateIndexMap(typename HistogramAnnotationData<T>::Histogram const &histogram, typename IndexMapAnnotationData<T>::IndexMap existingValues) {
     // ----------------------------------------------------------------------
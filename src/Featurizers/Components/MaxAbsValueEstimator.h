@@ -77,6 +77,9 @@ public:
     void fit(InputType const &input);
     MaxAbsValueAnnotationData<TransformedType> complete_training(void);
 
+    void save_training_state(Archive &ar) const;
+    void restore_training_state(Archive &ar);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -161,6 +164,16 @@ MaxAbsValueAnnotationData<TransformedT> Details::MaxAbsValueTrainingOnlyPolicy<I
     return MaxAbsValueAnnotationData<TransformedT>(_max);
 }
 
+template <typename InputT, typename TransformedT>
+void Details::MaxAbsValueTrainingOnlyPolicy<InputT, TransformedT>::save_training_state(Archive &ar) const {
+    Traits<TransformedT>::serialize(ar, _max);
+}
+
+template <typename InputT, typename TransformedT>
+void Details::MaxAbsValueTrainingOnlyPolicy<InputT, TransformedT>::restore_training_state(Archive &ar) {
+    _max = Traits<TransformedT>::deserialize(ar);
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
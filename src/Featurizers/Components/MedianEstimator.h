@@ -4,8 +4,10 @@
 // ----------------------------------------------------------------------
 #pragma once
 
-#include <queue>
+#include <algorithm>
+#include <vector>
 
+#include "QuantileSketch.h"
 #include "TrainingOnlyEstimatorImpl.h"
 
 namespace Microsoft {
@@ -14,6 +16,18 @@ namespace Featurizers {
 namespace Components {
 
 static constexpr char const * const         MedianEstimatorName("MedianEstimator");
+static constexpr double const               MedianEstimatorDefaultRankError(0.01);
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          MedianEstimatorMode
+///  \brief         Determines how the `MedianEstimator` computes the median.
+///
+enum class MedianEstimatorMode : std::uint8_t {
+    Exact = 1,                              ///< Values are buffered and the median is selected when training is complete
+    Approximate,                            ///< Values are added to a `QuantileSketch` whose memory is bounded by the requested rank error; only valid for arithmetic types
+
+    NumValues
+};
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         MedianAnnotationData
@@ -47,6 +61,11 @@ namespace Details {
 ///  \class         MedianTrainingOnlyPolicy
 ///  \brief         `MedianEstimator` implementation details.
 ///
+///                 In `Exact` mode, values are buffered in a vector and the
+///                 median is selected with `nth_element` once training is
+///                 complete. In `Approximate` mode, the median is within
+///                 about `rankError * n` ranks of the exact median.
+///
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 class MedianTrainingOnlyPolicy {
 public:
@@ -71,29 +90,21 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
+    MedianTrainingOnlyPolicy(MedianEstimatorMode mode=MedianEstimatorMode::Exact, double rankError=MedianEstimatorDefaultRankError);
+
     void fit(InputType const &input);
     MedianAnnotationData<TransformedT> complete_training(void);
 
 private:
-    // ----------------------------------------------------------------------
-    // |
-    // |  Private Types
-    // |
-    // ----------------------------------------------------------------------
-    // Note that a priority_queue is used here over another type, as a priority_queue
-    // ensures that sorting only happens when a value is retrieved while sorting would
-    // need to happen during insertion for other types. For this algorithm, it means
-    // that sorting only happens when we need to rebalance the queues.
-    using MaxHeapType                       = std::priority_queue<TransformedT>;
-    using MinHeapType                       = std::priority_queue<TransformedT, std::vector<TransformedT>, std::greater<TransformedT>>;
-
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    MaxHeapType                             _smaller;
-    MinHeapType                             _larger;
+    MedianEstimatorMode const               _mode;
+
+    std::vector<TransformedT>               _values;                        // Exact
+    QuantileSketch                          _sketch;                        // Approximate
 
     // ----------------------------------------------------------------------
     // |
@@ -106,8 +117,15 @@ private:
     template <typename U>
     void fit_impl(U const &input);
 
-    TransformedT _get_interpolated_value(std::true_type /*supports Interpolated values*/);
-    TransformedT _get_interpolated_value(std::false_type /*supports Interpolated values*/);
+    void update_sketch(TransformedT const &value, std::true_type /*is_arithmetic*/);
+    void update_sketch(TransformedT const &value, std::false_type /*is_arithmetic*/);
+
+    TransformedT get_exact_median(void);
+    TransformedT get_approximate_median(std::true_type /*is_arithmetic*/) const;
+    TransformedT get_approximate_median(std::false_type /*is_arithmetic*/) const;
+
+    static TransformedT _get_interpolated_value(TransformedT const &lower, TransformedT const &upper, std::true_type /*supports Interpolated values*/);
+    static TransformedT _get_interpolated_value(TransformedT const &lower, TransformedT const &upper, std::false_type /*supports Interpolated values*/);
 };
 
 } // namespace Details
@@ -117,6 +135,9 @@ private:
 ///  \brief         An `Estimator` that computes the median value encountered
 ///                 during training.
 ///
+///                 The mode and rank error can be provided after the
+///                 `requiresTraining` constructor argument.
+///
 template <
     typename InputT,
     typename TransformedT=InputT,
@@ -150,6 +171,22 @@ MedianAnnotationData<T>::MedianAnnotationData(T median) :
 // |  Details::MedianTrainingOnlyPolicy
 // |
 // ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::MedianTrainingOnlyPolicy(MedianEstimatorMode mode, double rankError) :
+    _mode(
+        [&mode](void) {
+            if(mode != MedianEstimatorMode::Exact && mode != MedianEstimatorMode::Approximate)
+                throw std::invalid_argument("mode");
+
+            if(mode == MedianEstimatorMode::Approximate && std::is_arithmetic<TransformedT>::value == false)
+                throw std::invalid_argument("mode");
+
+            return mode;
+        }()
+    ),
+    _sketch(_mode == MedianEstimatorMode::Approximate ? QuantileSketch::GetKForRankError(rankError) : QuantileSketch::MinK) {
+}
+
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit(InputType const &input) {
     fit_impl(input, std::integral_constant<bool, Traits<InputT>::IsNullableType>());
@@ -157,11 +194,60 @@ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>
 
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::complete_training(void) {
-    size_t const                            numElements(_smaller.size() + _larger.size());
+    if(_mode == MedianEstimatorMode::Approximate)
+        return get_approximate_median(std::integral_constant<bool, std::is_arithmetic<TransformedT>::value>());
+
+    return get_exact_median();
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(InputType const &input, std::true_type /*is_nullable*/) {
+    if(Traits<InputT>::IsNull(input))
+        return;
+
+    fit_impl(Traits<InputT>::GetNullableValue(input));
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(InputType const &input, std::false_type /*is_nullable*/) {
+    fit_impl(input);
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+template <typename U>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(U const &input) {
+    if(_mode == MedianEstimatorMode::Approximate)
+        update_sketch(static_cast<TransformedT>(input), std::integral_constant<bool, std::is_arithmetic<TransformedT>::value>());
+    else
+        _values.emplace_back(static_cast<TransformedT>(input));
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::update_sketch(TransformedT const &value, std::true_type /*is_arithmetic*/) {
+    _sketch.update(static_cast<double>(value));
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::update_sketch(TransformedT const &, std::false_type /*is_arithmetic*/) {
+    throw std::runtime_error("This should never be called");
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::get_exact_median(void) {
+    size_t const                            numElements(_values.size());
 
     if(numElements == 0)
         throw std::runtime_error("No elements were provided during training");
 
+    // The lower of the middle values; the upper value (when needed) is the
+    // smallest of the values after it.
+    typename std::vector<TransformedT>::iterator const                      iterLower(_values.begin() + static_cast<std::ptrdiff_t>((numElements - 1) / 2));
+
+    std::nth_element(_values.begin(), iterLower, _values.end());
+
     TransformedT                            median;
 
 #if (defined _MSC_VER)
@@ -169,91 +255,59 @@ MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, Tra
 #   pragma warning(disable: 4127) // conditional expression is constant
 #endif
 
-    if(InterpolateValuesV == false || numElements & 1) {
-        assert(_smaller.empty() == false);
-        assert(InterpolateValuesV == false || _smaller.size() == _larger.size() + 1);
-
-        median = _smaller.top();
-    }
+    if(InterpolateValuesV == false || numElements & 1)
+        median = *iterLower;
     else
-        median = this->_get_interpolated_value(std::integral_constant<bool, InterpolateValuesV>());
+        median = _get_interpolated_value(*iterLower, *std::min_element(iterLower + 1, _values.end()), std::integral_constant<bool, InterpolateValuesV>());
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
 #endif
 
     // Clean up after ourselves
-    _smaller = MaxHeapType();
-    _larger = MinHeapType();
+    _values = std::vector<TransformedT>();
 
     return median;
 }
 
-// ----------------------------------------------------------------------
-// ----------------------------------------------------------------------
-// ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
-void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(InputType const &input, std::true_type /*is_nullable*/) {
-    if(Traits<InputT>::IsNull(input))
-        return;
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::get_approximate_median(std::true_type /*is_arithmetic*/) const {
+    if(_sketch.empty())
+        throw std::runtime_error("No elements were provided during training");
 
-    fit_impl(Traits<InputT>::GetNullableValue(input));
-}
+    std::uint64_t const                     numElements(_sketch.count());
 
-template <typename InputT, typename TransformedT, bool InterpolateValuesV>
-void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(InputType const &input, std::false_type /*is_nullable*/) {
-    fit_impl(input);
-}
-
-template <typename InputT, typename TransformedT, bool InterpolateValuesV>
-template <typename U>
-void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(U const &input) {
-    if(_smaller.empty() || static_cast<TransformedT>(input) <= _smaller.top()) {
-#if (defined __apple_build_version__)
-        _smaller.push(static_cast<TransformedT>(input));
-#else
-        _smaller.emplace(static_cast<TransformedT>(input));
-#endif
-    }
-    else {
-#if (defined __apple_build_version__)
-        _larger.push(static_cast<TransformedT>(input));
-#else
-        _larger.emplace(static_cast<TransformedT>(input));
-#endif
-    }
-
-    // Rebalance if necessary
-    if(_smaller.size() >= _larger.size() + 2) {
-#if (defined __apple_build_version__)
-        _larger.push(_smaller.top());
-#else
-        _larger.emplace(_smaller.top());
+#if (defined _MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable: 4127) // conditional expression is constant
 #endif
-        _smaller.pop();
-    }
-    else if(_larger.size() > _smaller.size()) {
-#if (defined __apple_build_version__)
-        _smaller.push(_larger.top());
-#else
-        _smaller.emplace(_larger.top());
+
+    if(InterpolateValuesV == false || numElements & 1)
+        return static_cast<TransformedT>(_sketch.value_at_rank((numElements - 1) / 2));
+
+#if (defined _MSC_VER)
+#   pragma warning(pop)
 #endif
-        _larger.pop();
-    }
+
+    // Fetch both middle values with a single pass over the sorted sketch
+    std::vector<double> const               values(_sketch.values_at_ranks({(numElements - 1) / 2, numElements / 2}));
+
+    return _get_interpolated_value(static_cast<TransformedT>(values[0]), static_cast<TransformedT>(values[1]), std::integral_constant<bool, InterpolateValuesV>());
 }
 
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
-TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_value(std::true_type /*supports Interpolated values*/) {
-    assert(_smaller.empty() == false);
-
-    TransformedT const                      greater(_larger.empty() ? 0 : _larger.top());
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::get_approximate_median(std::false_type /*is_arithmetic*/) const {
+    throw std::runtime_error("This should never be called");
+}
 
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+/*static*/ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_value(TransformedT const &lower, TransformedT const &upper, std::true_type /*supports Interpolated values*/) {
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wdouble-promotion"
 #endif
 
-    return static_cast<TransformedT>((static_cast<double>(_smaller.top()) + greater) / 2);
+    return static_cast<TransformedT>((static_cast<double>(lower) + upper) / 2);
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -261,7 +315,7 @@ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, Interpolate
 }
 
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
-TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_value(std::false_type /*supports Interpolated values*/) {
+/*static*/ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_value(TransformedT const &, TransformedT const &, std::false_type /*supports Interpolated values*/) {
     throw std::runtime_error("This should never be called");
 }
 
@@ -79,6 +79,9 @@ public:
     void fit(InputType const &input);
     MinMaxAnnotationData<T> complete_training(void);
 
+    void save_training_state(Archive &ar) const;
+    void restore_training_state(Archive &ar);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -150,6 +153,18 @@ MinMaxAnnotationData<T> Details::MinMaxTrainingOnlyPolicy<T>::complete_training(
     return MinMaxAnnotationData<T>(std::move(_min), std::move(_max));
 }
 
+template <typename T>
+void Details::MinMaxTrainingOnlyPolicy<T>::save_training_state(Archive &ar) const {
+    Traits<T>::serialize(ar, _min);
+    Traits<T>::serialize(ar, _max);
+}
+
+template <typename T>
+void Details::MinMaxTrainingOnlyPolicy<T>::restore_training_state(Archive &ar) {
+    _min = Traits<T>::deserialize(ar);
+    _max = Traits<T>::deserialize(ar);
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            MurmurHash3_x86_32_Batch
+///  \brief         Hashes `cItems` fixed-size values, producing the same results
+///                 as calling `MurmurHash3_x86_32` on the bytes of each value.
+///
+///                 Values are processed `MurmurHash3BatchLanes` at a time, with
+///                 each step of the algorithm applied to all lanes before moving
+///                 on to the next step. Every lane performs the same operations
+///                 (the number of blocks and tail bytes is a property of the type),
+///                 so the inner loops don't contain branches and compilers emit
+///                 SIMD instructions for them on any ISA that has 32-bit vector
+///                 multiplies, without the need for platform-specific intrinsics.
+///
+template <typename T>
+void MurmurHash3_x86_32_Batch(T const *pInput, size_t cItems, std::uint32_t seed, std::uint32_t *pOutput);
+
+static constexpr size_t const               MurmurHash3BatchLanes = 8;
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+inline std::uint32_t MurmurHash3Rotl32(std::uint32_t x, int r) {
+    return (x << r) | (x >> (32 - r));
+}
+
+inline std::uint32_t MurmurHash3Fmix32(std::uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+
+    return h;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MurmurHash3BatchImpl
+///  \brief         Hashes `NumLanesV` values of `cbValueV` bytes each.
+///
+template <size_t cbValueV, size_t NumLanesV>
+struct MurmurHash3BatchImpl {
+    static constexpr size_t const           NumBlocks = cbValueV / 4;
+    static constexpr size_t const           NumTailBytes = cbValueV & 3;
+
+    static void Execute(unsigned char const *pData, std::uint32_t seed, std::uint32_t *pOutput) {
+        std::uint32_t const                 c1(0xcc9e2d51);
+        std::uint32_t const                 c2(0x1b873593);
+
+        std::uint32_t                       h[NumLanesV];
+
+        for(size_t lane = 0; lane < NumLanesV; ++lane)
+            h[lane] = seed;
+
+        // Body
+        for(size_t block = 0; block < NumBlocks; ++block) {
+            std::uint32_t                   k[NumLanesV];
+
+            // The reference implementation reads blocks in the platform's native
+            // byte order, which is what memcpy produces.
+            for(size_t lane = 0; lane < NumLanesV; ++lane)
+                std::memcpy(&k[lane], pData + lane * cbValueV + block * 4, sizeof(k[lane]));
+
+            for(size_t lane = 0; lane < NumLanesV; ++lane) {
+                std::uint32_t               k1(k[lane]);
+
+                k1 *= c1;
+                k1 = MurmurHash3Rotl32(k1, 15);
+                k1 *= c2;
+
+                std::uint32_t               h1(h[lane] ^ k1);
+
+                h1 = MurmurHash3Rotl32(h1, 13);
+                h[lane] = h1 * 5 + 0xe6546b64;
+            }
+        }
+
+        // Tail
+        if(NumTailBytes != 0) {
+            for(size_t lane = 0; lane < NumLanesV; ++lane) {
+                unsigned char const * const tail(pData + lane * cbValueV + NumBlocks * 4);
+                std::uint32_t               k1(0);
+
+                if(NumTailBytes >= 3)
+                    k1 ^= static_cast<std::uint32_t>(tail[2]) << 16;
+                if(NumTailBytes >= 2)
+                    k1 ^= static_cast<std::uint32_t>(tail[1]) << 8;
+
+                k1 ^= tail[0];
+                k1 *= c1;
+                k1 = MurmurHash3Rotl32(k1, 15);
+                k1 *= c2;
+
+                h[lane] ^= k1;
+            }
+        }
+
+        // Finalization
+        for(size_t lane = 0; lane < NumLanesV; ++lane)
+            pOutput[lane] = MurmurHash3Fmix32(h[lane] ^ static_cast<std::uint32_t>(cbValueV));
+    }
+};
+
+} // namespace Details
+
+template <typename T>
+void MurmurHash3_x86_32_Batch(T const *pInput, size_t cItems, std::uint32_t seed, std::uint32_t *pOutput) {
+    static_assert(std::is_pod<T>::value, "Input must be PODs");
+    static_assert(sizeof(T) < (1u << 31), "Values are too large");
+
+    unsigned char const *                   pData(reinterpret_cast<unsigned char const *>(pInput));
+
+    while(cItems >= MurmurHash3BatchLanes) {
+        Details::MurmurHash3BatchImpl<sizeof(T), MurmurHash3BatchLanes>::Execute(pData, seed, pOutput);
+
+        pData += MurmurHash3BatchLanes * sizeof(T);
+        pOutput += MurmurHash3BatchLanes;
+        cItems -= MurmurHash3BatchLanes;
+    }
+
+    while(cItems) {
+        Details::MurmurHash3BatchImpl<sizeof(T), 1>::Execute(pData, seed, pOutput);
+
+        pData += sizeof(T);
+        ++pOutput;
+        --cItems;
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
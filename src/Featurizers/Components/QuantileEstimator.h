@@ -0,0 +1,227 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "QuantileSketch.h"
+#include "TrainingOnlyEstimatorImpl.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+static constexpr char const * const         QuantileEstimatorName("QuantileEstimator");
+static constexpr double const               QuantileEstimatorDefaultRankError(0.001);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileAnnotationData
+///  \brief         Annotation produced that contains the values of the requested
+///                 quantiles encountered during training.
+///
+class QuantileAnnotationData {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<double> const               Quantiles;                      ///< Requested quantiles, in the range [0, 1]
+    std::vector<double> const               Values;                         ///< Value of each requested quantile
+    std::uint64_t const                     Count;                          ///< Number of non-null values encountered during training
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    QuantileAnnotationData(std::vector<double> quantiles, std::vector<double> values, std::uint64_t count);
+    ~QuantileAnnotationData(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(QuantileAnnotationData);
+
+    /// Returns the value of a quantile that was requested during construction
+    double get_value(double quantile) const;
+};
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileTrainingOnlyPolicy
+///  \brief         `QuantileEstimator` implementation details.
+///
+template <typename InputT>
+class QuantileTrainingOnlyPolicy {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using InputType                         = InputT;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr char const * const     NameValue = QuantileEstimatorName;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    QuantileTrainingOnlyPolicy(std::vector<double> quantiles, double rankError=QuantileEstimatorDefaultRankError);
+
+    void fit(InputType const &input);
+    QuantileAnnotationData complete_training(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<double> const               _quantiles;
+    QuantileSketch                          _sketch;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void fit_impl(InputType const &input, std::true_type /*is_nullable*/);
+    void fit_impl(InputType const &input, std::false_type /*is_nullable*/);
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       QuantileEstimator
+///  \brief         An `Estimator` that computes any number of quantiles of the
+///                 non-null values encountered during training in a single
+///                 pass, using a `QuantileSketch` whose memory is bounded by
+///                 the requested rank error.
+///
+///                 The quantiles (and optionally the rank error) are provided
+///                 after the `requiresTraining` constructor argument. Results
+///                 are exact until the sketch begins compacting values.
+///
+template <
+    typename InputT,
+    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()
+>
+using QuantileEstimator                     = TrainingOnlyEstimatorImpl<Details::QuantileTrainingOnlyPolicy<InputT>, MaxNumTrainingItemsV>;
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  QuantileAnnotationData
+// |
+// ----------------------------------------------------------------------
+inline QuantileAnnotationData::QuantileAnnotationData(std::vector<double> quantiles, std::vector<double> values, std::uint64_t count) :
+    Quantiles(std::move(quantiles)),
+    Values(
+        std::move(
+            [this, &values](void) -> std::vector<double> & {
+                if(values.size() != Quantiles.size())
+                    throw std::invalid_argument("values");
+
+                return values;
+            }()
+        )
+    ),
+    Count(
+        [&count](void) {
+            if(count == 0)
+                throw std::invalid_argument("count");
+
+            return count;
+        }()
+    ) {
+}
+
+inline double QuantileAnnotationData::get_value(double quantile) const {
+    std::vector<double>::const_iterator const                               iter(std::find(Quantiles.begin(), Quantiles.end(), quantile));
+
+    if(iter == Quantiles.end())
+        throw std::invalid_argument("quantile");
+
+    return Values[static_cast<size_t>(iter - Quantiles.begin())];
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Details::QuantileTrainingOnlyPolicy
+// |
+// ----------------------------------------------------------------------
+template <typename InputT>
+Details::QuantileTrainingOnlyPolicy<InputT>::QuantileTrainingOnlyPolicy(std::vector<double> quantiles, double rankError) :
+    _quantiles(
+        std::move(
+            [&quantiles](void) -> std::vector<double> & {
+                for(double quantile : quantiles) {
+                    if(quantile < 0.0 || quantile > 1.0 || std::isnan(quantile))
+                        throw std::invalid_argument("quantiles");
+                }
+
+                return quantiles;
+            }()
+        )
+    ),
+    _sketch(QuantileSketch::GetKForRankError(rankError)) {
+}
+
+template <typename InputT>
+void Details::QuantileTrainingOnlyPolicy<InputT>::fit(InputType const &input) {
+    fit_impl(input, std::integral_constant<bool, Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT>
+QuantileAnnotationData Details::QuantileTrainingOnlyPolicy<InputT>::complete_training(void) {
+    if(_sketch.empty())
+        throw std::runtime_error("No elements were provided during training");
+
+    QuantileAnnotationData                  result(_quantiles, _sketch.quantiles(_quantiles), _sketch.count());
+
+    // Clean up after ourselves
+    _sketch = QuantileSketch(_sketch.k());
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename InputT>
+void Details::QuantileTrainingOnlyPolicy<InputT>::fit_impl(InputType const &input, std::true_type /*is_nullable*/) {
+    if(Traits<InputT>::IsNull(input))
+        return;
+
+    _sketch.update(static_cast<double>(Traits<InputT>::GetNullableValue(input)));
+}
+
+template <typename InputT>
+void Details::QuantileTrainingOnlyPolicy<InputT>::fit_impl(InputType const &input, std::false_type /*is_nullable*/) {
+    _sketch.update(static_cast<double>(input));
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
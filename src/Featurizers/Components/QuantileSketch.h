@@ -0,0 +1,478 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileSketch
+///  \brief         Memory-bounded, mergeable quantile sketch (KLL).
+///
+///                 Values are buffered exactly until more than `k` of them
+///                 have been seen, so results for small populations are
+///                 exact. From then on, levels over capacity are compacted by
+///                 sorting them and promoting every other value to the next
+///                 level, where each value stands for twice as many inputs.
+///                 Level capacities shrink geometrically from the top level
+///                 down, so a sketch never retains more than about 3 * k
+///                 values regardless of how many it has seen.
+///
+///                 Compaction alternates deterministically between keeping the
+///                 even and odd values, so results are reproducible for a given
+///                 input order.
+///
+class QuantileSketch {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint16_t const    MinK = 8;
+    static constexpr std::uint16_t const    DefaultK = 128;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    /// Returns the `k` needed for a normalized rank error of about `rankError`
+    /// (0 < rankError < 1). The worst error observed for both shuffled and
+    /// sorted inputs is about 5 / k.
+    static std::uint16_t GetKForRankError(double rankError);
+
+    QuantileSketch(std::uint16_t k=DefaultK);
+    QuantileSketch(Archive &ar);
+
+    bool operator==(QuantileSketch const &other) const;
+
+    void update(double value);
+
+    /// Adds the values seen by `other` to this sketch; `other` may have
+    /// been created with a different `k`, in which case this sketch's `k`
+    /// is retained.
+    void merge(QuantileSketch const &other);
+
+    std::uint16_t k(void) const;
+
+    /// Number of values seen
+    std::uint64_t count(void) const;
+
+    bool empty(void) const;
+
+    /// Number of values currently held in memory
+    size_t num_retained(void) const;
+
+    /// Returns true if no values have been compacted, in which case the
+    /// results of `quantile` are exact
+    bool is_exact(void) const;
+
+    /// Returns the q-th quantile (0 <= q <= 1), linearly interpolating
+    /// between the two closest ranks
+    double quantile(double q) const;
+
+    /// Returns the quantile for each value in `qs`; this is more efficient
+    /// than calling `quantile` for each value, as the retained values are
+    /// only sorted once
+    std::vector<double> quantiles(std::vector<double> const &qs) const;
+
+    double median(void) const;
+
+    /// Returns the value with the 0-based `rank` in the sorted values
+    double value_at_rank(std::uint64_t rank) const;
+
+    /// Returns the value for each rank in `ranks`; this is more efficient
+    /// than calling `value_at_rank` for each rank, as the retained values are
+    /// only sorted once
+    std::vector<double> values_at_ranks(std::vector<std::uint64_t> const &ranks) const;
+
+    void save(Archive &ar) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using LevelsType                        = std::vector<std::vector<double>>;
+    using WeightedValues                    = std::vector<std::pair<double, std::uint64_t>>;
+
+    static constexpr std::uint32_t const    MinLevelCapacity = 2;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint16_t                           _k;
+    bool                                    _coin;
+    std::uint64_t                           _count;
+
+    // Values at level `n` have a weight of 2^n
+    LevelsType                              _levels;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static std::uint32_t level_capacity(std::uint16_t k, size_t numLevels, size_t level);
+
+    void compress(void);
+    void compact(size_t level);
+
+    /// Returns the retained values and their weights, sorted by value
+    WeightedValues get_sorted_values(void) const;
+
+    static double get_quantile(WeightedValues const &items, std::uint64_t count, double q);
+    static double get_value_at_rank(WeightedValues const &items, std::uint64_t rank);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline /*static*/ std::uint16_t QuantileSketch::GetKForRankError(double rankError) {
+    if(rankError <= 0.0 || rankError >= 1.0 || std::isnan(rankError))
+        throw std::invalid_argument("rankError");
+
+    double const                            k(std::ceil(5.0 / rankError));
+
+    if(k > static_cast<double>(std::numeric_limits<std::uint16_t>::max()))
+        throw std::invalid_argument("rankError");
+
+    return std::max(static_cast<std::uint16_t>(MinK), static_cast<std::uint16_t>(k));
+}
+
+inline QuantileSketch::QuantileSketch(std::uint16_t k) :
+    _k(
+        [&k](void) {
+            if(k < MinK)
+                throw std::invalid_argument("k");
+
+            return k;
+        }()
+    ),
+    _coin(false),
+    _count(0) {
+}
+
+inline QuantileSketch::QuantileSketch(Archive &ar) :
+    _k(
+        [&ar](void) {
+            std::uint16_t                   k(Traits<std::uint16_t>::deserialize(ar));
+
+            if(k < MinK)
+                throw std::invalid_argument("k");
+
+            return k;
+        }()
+    ),
+    _coin(Traits<bool>::deserialize(ar)),
+    _count(Traits<std::uint64_t>::deserialize(ar)),
+    _levels(Traits<LevelsType>::deserialize(ar)) {
+    // Values at level `n` have a weight of 2^n, which must fit in the weight type
+    if(_levels.size() >= static_cast<size_t>(std::numeric_limits<std::uint64_t>::digits))
+        throw std::runtime_error("Invalid levels");
+
+    std::uint64_t                           weight(0);
+
+    for(size_t level = 0; level < _levels.size(); ++level) {
+        std::uint64_t const                 size(static_cast<std::uint64_t>(_levels[level].size()));
+
+        // Don't let the weight wrap around and match an arbitrary count
+        if(
+            size > (std::numeric_limits<std::uint64_t>::max() >> level)
+            || (size << level) > std::numeric_limits<std::uint64_t>::max() - weight
+        )
+            throw std::runtime_error("Invalid quantile sketch");
+
+        weight += size << level;
+    }
+
+    if(weight != _count)
+        throw std::runtime_error("Invalid quantile sketch");
+}
+
+inline bool QuantileSketch::operator==(QuantileSketch const &other) const {
+    return _k == other._k
+        && _coin == other._coin
+        && _count == other._count
+        && _levels == other._levels;
+}
+
+inline void QuantileSketch::update(double value) {
+    if(std::isnan(value))
+        throw std::invalid_argument("value");
+
+    if(_levels.empty())
+        _levels.emplace_back();
+
+    _levels[0].emplace_back(value);
+    ++_count;
+
+    if(_levels[0].size() > level_capacity(_k, _levels.size(), 0))
+        compress();
+}
+
+inline void QuantileSketch::merge(QuantileSketch const &other) {
+    if(&other == this) {
+        QuantileSketch const                copy(other);
+
+        merge(copy);
+        return;
+    }
+
+    if(other._count == 0)
+        return;
+
+    if(_levels.size() < other._levels.size())
+        _levels.resize(other._levels.size());
+
+    for(size_t level = 0; level < other._levels.size(); ++level)
+        _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+
+    _count += other._count;
+
+    compress();
+}
+
+inline std::uint16_t QuantileSketch::k(void) const {
+    return _k;
+}
+
+inline std::uint64_t QuantileSketch::count(void) const {
+    return _count;
+}
+
+inline bool QuantileSketch::empty(void) const {
+    return _count == 0;
+}
+
+inline size_t QuantileSketch::num_retained(void) const {
+    size_t                                  result(0);
+
+    for(auto const &level : _levels)
+        result += level.size();
+
+    return result;
+}
+
+inline bool QuantileSketch::is_exact(void) const {
+    return _levels.size() <= 1;
+}
+
+inline double QuantileSketch::quantile(double q) const {
+    if(q < 0.0 || q > 1.0 || std::isnan(q))
+        throw std::invalid_argument("q");
+
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    return get_quantile(get_sorted_values(), _count, q);
+}
+
+inline std::vector<double> QuantileSketch::quantiles(std::vector<double> const &qs) const {
+    for(double q : qs) {
+        if(q < 0.0 || q > 1.0 || std::isnan(q))
+            throw std::invalid_argument("qs");
+    }
+
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    WeightedValues const                    items(get_sorted_values());
+    std::vector<double>                     result;
+
+    result.reserve(qs.size());
+
+    for(double q : qs)
+        result.emplace_back(get_quantile(items, _count, q));
+
+    return result;
+}
+
+inline double QuantileSketch::median(void) const {
+    return quantile(0.5);
+}
+
+inline double QuantileSketch::value_at_rank(std::uint64_t rank) const {
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    if(rank >= _count)
+        throw std::invalid_argument("rank");
+
+    return get_value_at_rank(get_sorted_values(), rank);
+}
+
+inline std::vector<double> QuantileSketch::values_at_ranks(std::vector<std::uint64_t> const &ranks) const {
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    for(std::uint64_t rank : ranks) {
+        if(rank >= _count)
+            throw std::invalid_argument("ranks");
+    }
+
+    WeightedValues const                    items(get_sorted_values());
+    std::vector<double>                     result;
+
+    result.reserve(ranks.size());
+
+    for(std::uint64_t rank : ranks)
+        result.emplace_back(get_value_at_rank(items, rank));
+
+    return result;
+}
+
+inline void QuantileSketch::save(Archive &ar) const {
+    Traits<std::uint16_t>::serialize(ar, _k);
+    Traits<bool>::serialize(ar, _coin);
+    Traits<std::uint64_t>::serialize(ar, _count);
+    Traits<LevelsType>::serialize(ar, _levels);
+}
+
+// ----------------------------------------------------------------------
+inline /*static*/ std::uint32_t QuantileSketch::level_capacity(std::uint16_t k, size_t numLevels, size_t level) {
+    double const                            capacity(static_cast<double>(k) * std::pow(2.0 / 3.0, static_cast<double>(numLevels - level - 1)));
+
+    return std::max(static_cast<std::uint32_t>(MinLevelCapacity), static_cast<std::uint32_t>(capacity));
+}
+
+inline void QuantileSketch::compress(void) {
+    while(true) {
+        size_t                              retained(0);
+        size_t                              capacity(0);
+
+        for(size_t level = 0; level < _levels.size(); ++level) {
+            retained += _levels[level].size();
+            capacity += level_capacity(_k, _levels.size(), level);
+        }
+
+        if(retained <= capacity)
+            return;
+
+        // Compact the lowest level that is over capacity
+        size_t                              level(0);
+
+        while(_levels[level].size() <= level_capacity(_k, _levels.size(), level))
+            ++level;
+
+        if(level + 1 == _levels.size())
+            _levels.emplace_back();
+
+        compact(level);
+    }
+}
+
+inline QuantileSketch::WeightedValues QuantileSketch::get_sorted_values(void) const {
+    WeightedValues                          result;
+
+    result.reserve(num_retained());
+
+    for(size_t level = 0; level < _levels.size(); ++level) {
+        std::uint64_t const                 weight(static_cast<std::uint64_t>(1) << level);
+
+        for(double value : _levels[level])
+            result.emplace_back(value, weight);
+    }
+
+    std::sort(
+        result.begin(),
+        result.end(),
+        [](std::pair<double, std::uint64_t> const &a, std::pair<double, std::uint64_t> const &b) {
+            return a.first < b.first;
+        }
+    );
+
+    return result;
+}
+
+inline void QuantileSketch::compact(size_t level) {
+    std::vector<double> &                   items(_levels[level]);
+    std::vector<double> &                   next(_levels[level + 1]);
+
+    std::sort(items.begin(), items.end());
+
+    // An odd value out stays at this level so that the total weight is preserved
+    bool const                              hasLeftover(items.size() % 2 != 0);
+    double const                            leftover(hasLeftover ? items.back() : 0.0);
+
+    if(hasLeftover)
+        items.pop_back();
+
+    for(size_t index = _coin ? 1 : 0; index < items.size(); index += 2)
+        next.emplace_back(items[index]);
+
+    _coin = !_coin;
+
+    items.clear();
+
+    if(hasLeftover)
+        items.emplace_back(leftover);
+}
+
+inline /*static*/ double QuantileSketch::get_quantile(WeightedValues const &items, std::uint64_t count, double q) {
+    double const                            rank(q * static_cast<double>(count - 1));
+    std::uint64_t const                     lowerRank(static_cast<std::uint64_t>(rank));
+    std::uint64_t const                     upperRank(std::min(lowerRank + 1, count - 1));
+
+    // Each item covers the ranks [cumulative, cumulative + weight)
+    WeightedValues::const_iterator                                      iter(items.begin());
+    std::uint64_t                                                       cumulative(iter->second);
+
+    while(cumulative <= lowerRank) {
+        ++iter;
+        cumulative += iter->second;
+    }
+
+    double const                            lowerValue(iter->first);
+
+    while(cumulative <= upperRank) {
+        ++iter;
+        cumulative += iter->second;
+    }
+
+    double const                            upperValue(iter->first);
+
+    return lowerValue + (upperValue - lowerValue) * (rank - static_cast<double>(lowerRank));
+}
+
+inline /*static*/ double QuantileSketch::get_value_at_rank(WeightedValues const &items, std::uint64_t rank) {
+    WeightedValues::const_iterator          iter(items.begin());
+    std::uint64_t                           cumulative(iter->second);
+
+    while(cumulative <= rank) {
+        ++iter;
+        cumulative += iter->second;
+    }
+
+    return iter->first;
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#include "ScratchFile.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <Windows.h>
+#else
+#   include <unistd.h>
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+namespace {
+
+// `std::tmpfile` creates files in the root directory on Windows, which usually
+// isn't writable; the file is created in the temporary directory instead.
+#if (defined _WIN32)
+    std::FILE * CreateTemporaryFile(void) {
+        char                                directory[MAX_PATH + 1];
+        DWORD const                         cchDirectory(GetTempPathA(static_cast<DWORD>(sizeof(directory)), directory));
+
+        if(cchDirectory == 0 || cchDirectory >= sizeof(directory))
+            return nullptr;
+
+        char                                filename[MAX_PATH];
+
+        if(GetTempFileNameA(directory, "ftr", 0, filename) == 0)
+            return nullptr;
+
+        // "D" deletes the file when it is closed
+        std::FILE *                         pFile(nullptr);
+
+        if(fopen_s(&pFile, filename, "w+bD") != 0) {
+            DeleteFileA(filename);
+            return nullptr;
+        }
+
+        return pFile;
+    }
+#else
+    std::FILE * CreateTemporaryFile(void) {
+        char const * const                  directory(std::getenv("TMPDIR"));
+        std::string                         filename(directory && *directory ? directory : "/tmp");
+
+        filename += "/FeaturizerScratchXXXXXX";
+
+        int const                           fd(mkstemp(&filename[0]));
+
+        if(fd == -1)
+            return nullptr;
+
+        // The file is deleted when the last handle is closed
+        unlink(filename.c_str());
+
+        std::FILE * const                   pFile(fdopen(fd, "w+b"));
+
+        if(pFile == nullptr)
+            close(fd);
+
+        return pFile;
+    }
+#endif
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  ScratchFile
+// |
+// ----------------------------------------------------------------------
+ScratchFile::ScratchFile(void) :
+    _pFile(
+        [](void) {
+            FileUniquePtr                   pFile(CreateTemporaryFile(), &std::fclose);
+
+            if(!pFile)
+                throw std::runtime_error("The scratch file could not be created");
+
+            return pFile;
+        }()
+    ),
+    _size(0) {
+}
+
+std::uint64_t ScratchFile::append(unsigned char const *pBuffer, size_t cbBuffer) {
+    std::uint64_t const                     offset(_size);
+
+    write(offset, pBuffer, cbBuffer);
+    return offset;
+}
+
+void ScratchFile::write(std::uint64_t offset, unsigned char const *pBuffer, size_t cbBuffer) {
+    if(pBuffer == nullptr && cbBuffer != 0)
+        throw std::invalid_argument("pBuffer");
+
+    if(offset > _size)
+        throw std::invalid_argument("offset");
+
+    if(cbBuffer == 0)
+        return;
+
+    seek(offset);
+
+    if(std::fwrite(pBuffer, 1, cbBuffer, _pFile.get()) != cbBuffer)
+        throw std::runtime_error("The scratch file could not be written");
+
+    _size = std::max(_size, offset + cbBuffer);
+}
+
+Archive::ByteArray ScratchFile::read(std::uint64_t offset, size_t cbBuffer) const {
+    if(offset > _size || cbBuffer > _size - offset)
+        throw std::invalid_argument("offset");
+
+    Archive::ByteArray                      result(cbBuffer);
+
+    if(cbBuffer == 0)
+        return result;
+
+    seek(offset);
+
+    if(std::fread(result.data(), 1, cbBuffer, _pFile.get()) != cbBuffer)
+        throw std::runtime_error("The scratch file could not be read");
+
+    return result;
+}
+
+std::uint64_t ScratchFile::size(void) const {
+    return _size;
+}
+
+// ----------------------------------------------------------------------
+void ScratchFile::seek(std::uint64_t offset) const {
+#if (defined _MSC_VER)
+    int const                               result(_fseeki64(_pFile.get(), static_cast<__int64>(offset), SEEK_SET));
+#else
+    if(offset > static_cast<std::uint64_t>(std::numeric_limits<long>::max()))
+        throw std::runtime_error("The scratch file is too large");
+
+    int const                               result(std::fseek(_pFile.get(), static_cast<long>(offset), SEEK_SET));
+#endif
+
+    if(result != 0)
+        throw std::runtime_error("The scratch file could not be positioned");
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "../../Archive.h"
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ScratchFile
+///  \brief         Temporary file used to hold data that doesn't need to be
+///                 in memory. The file is created in the system's temporary
+///                 directory and is deleted when the object is destroyed.
+///
+class ScratchFile {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ScratchFile(void);
+
+    ~ScratchFile(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(ScratchFile);
+
+    /// Writes the data at the end of the file and returns its offset
+    std::uint64_t append(unsigned char const *pBuffer, size_t cbBuffer);
+
+    /// Overwrites data previously written to the file
+    void write(std::uint64_t offset, unsigned char const *pBuffer, size_t cbBuffer);
+
+    Archive::ByteArray read(std::uint64_t offset, size_t cbBuffer) const;
+
+    std::uint64_t size(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using FileUniquePtr                     = std::unique_ptr<std::FILE, int (*)(std::FILE *)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    FileUniquePtr                           _pFile;
+    std::uint64_t                           _size;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void seek(std::uint64_t offset) const;
+};
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
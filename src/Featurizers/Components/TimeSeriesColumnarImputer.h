@@ -0,0 +1,716 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "TimeSeriesImputerTransformer.h"
+
+#include <deque>
+#include <limits>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            IsValidityBitSet
+///  \brief         Returns true if row `index` holds a value according to the
+///                 validity bitmap (least significant bit first). A null
+///                 bitmap indicates that every row holds a value.
+///
+bool IsValidityBitSet(std::uint8_t const *pValidity, size_t index);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            AppendValidityBit
+///  \brief         Appends the validity bit for row `index`, where `index` is
+///                 the number of bits already in the bitmap.
+///
+void AppendValidityBit(std::vector<std::uint8_t> &validity, size_t index, bool isValid);
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TimeSeriesValueColumn
+///  \brief         Non-owning view of a column of values to impute.
+///
+template <typename T>
+struct TimeSeriesValueColumn {
+    T const *                               pValues;
+    std::uint8_t const *                    pValidity; ///< Bitmap of rows that hold a value; nullptr if all rows hold a value
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TimeSeriesColumnarInput
+///  \brief         Non-owning view of a batch of rows to impute. Grains are
+///                 identified by dense ids assigned by the caller (0..N) and
+///                 times are ticks in a unit chosen by the caller; the
+///                 frequency must be expressed in the same unit.
+///
+template <typename T>
+struct TimeSeriesColumnarInput {
+    std::uint32_t const *                   pGrainIds;
+    std::int64_t const *                    pTimes;
+    size_t                                  cRows;
+    std::vector<TimeSeriesValueColumn<T>>   columns;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TimeSeriesColumnarOutput
+///  \brief         Rows produced by the TimeSeriesColumnarImputer. Rows are
+///                 appended to the existing content; `validity` contains one
+///                 bitmap per column with the same layout used by the input.
+///
+template <typename T>
+struct TimeSeriesColumnarOutput {
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<std::uint8_t>               added; ///< 1 if the row was generated to fill a gap
+    std::vector<std::uint32_t>              grainIds;
+    std::vector<std::int64_t>               times;
+    std::vector<std::vector<T>>             values;
+    std::vector<std::vector<std::uint8_t>>  validity;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimeSeriesColumnarOutput(size_t cColumns);
+
+    size_t size(void) const;
+    bool is_valid(size_t column, size_t row) const;
+
+    void clear(void);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimeSeriesColumnarStatistics
+///  \brief         Computes the frequency and per-grain median values used by
+///                 TimeSeriesColumnarImputer directly from typed columns.
+///                 The values are computed the same way as
+///                 TimeSeriesFrequencyEstimator and TimeSeriesMedianEstimator.
+///
+template <typename T>
+class TimeSeriesColumnarStatistics {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using MedianValues                      = std::vector<std::vector<T>>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimeSeriesColumnarStatistics(size_t cColumns, std::uint16_t sketchSize=QuantileSketch::DefaultK);
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesColumnarStatistics);
+
+    void fit(TimeSeriesColumnarInput<T> const &input);
+
+    /// Smallest interval between consecutive rows of the same grain
+    std::int64_t get_frequency(void) const;
+
+    /// Median values indexed by grain id; grains not seen during fit are empty
+    MedianValues get_median_values(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct GrainStatistics {
+        bool                                hasLastTime;
+        std::int64_t                        lastTime;
+        std::vector<QuantileSketch>         sketches;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                            _cColumns;
+    std::uint16_t const                     _sketchSize;
+    std::int64_t                            _minFrequency;
+    std::vector<GrainStatistics>            _grains;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimeSeriesColumnarImputer
+///  \brief         Typed, columnar counterpart of
+///                 TimeSeriesImputerEstimator::Transformer. Rows are
+///                 generated for gaps in each grain and missing values are
+///                 imputed using the Forward, Backward, Median, or Interpolate
+///                 strategies without converting values to and from strings.
+///
+///                 State is tracked per grain id, so rows may be streamed
+///                 over multiple calls to `execute`; `flush` emits any rows
+///                 still waiting for a value (Backward and Interpolate).
+///
+template <typename T>
+class TimeSeriesColumnarImputer {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using InputType                         = TimeSeriesColumnarInput<T>;
+    using OutputType                        = TimeSeriesColumnarOutput<T>;
+    using MedianValues                      = std::vector<std::vector<T>>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    std::int64_t const                      Frequency;
+    size_t const                            NumColumns;
+    TimeSeriesImputeStrategy const          Strategy;
+    bool const                              SuppressError;
+    MedianValues const                      Medians;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimeSeriesColumnarImputer(
+        std::int64_t frequency,
+        size_t cColumns,
+        TimeSeriesImputeStrategy strategy,
+        bool suppressError,
+        MedianValues medianValues=MedianValues()
+    );
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesColumnarImputer);
+
+    void execute(InputType const &input, OutputType &output);
+    void flush(OutputType &output);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct GrainState {
+        bool                                hasLastRow;
+        std::int64_t                        lastTime;
+
+        // Forward: values of the last row emitted
+        // Interpolate: last value seen in each column and its time
+        std::vector<T>                      lastValues;
+        std::vector<std::uint8_t>           lastValid;
+        std::vector<std::int64_t>           lastValueTimes;
+
+        // Backward and Interpolate: rows waiting for a value, stored row-major. Every column
+        // is null for the rows in [nullStart[column], pendingBase + pendingTimes.size())
+        // and holds a value for the rows before that.
+        std::uint64_t                       pendingBase;
+        std::deque<std::int64_t>            pendingTimes;
+        std::deque<std::uint8_t>            pendingAdded;
+        std::deque<T>                       pendingValues;
+        std::deque<std::uint8_t>            pendingValid;
+        std::vector<std::uint64_t>          nullStart;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<GrainState>                 _grains;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    GrainState & get_grain(std::uint32_t grainId);
+
+    void ffill_or_median(GrainState &state, std::uint32_t grainId, std::int64_t time, bool added, InputType const *pInput, size_t row, OutputType &output);
+    void add_pending(GrainState &state, std::int64_t time, bool added, InputType const *pInput, size_t row);
+    void emit_pending(GrainState &state, std::uint32_t grainId, std::uint64_t end, OutputType &output);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline bool IsValidityBitSet(std::uint8_t const *pValidity, size_t index) {
+    return pValidity == nullptr || (pValidity[index >> 3] & (1 << (index & 7))) != 0;
+}
+
+inline void AppendValidityBit(std::vector<std::uint8_t> &validity, size_t index, bool isValid) {
+    if((index & 7) == 0)
+        validity.push_back(0);
+
+    if(isValid)
+        validity.back() = static_cast<std::uint8_t>(validity.back() | (1 << (index & 7)));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesColumnarOutput
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+TimeSeriesColumnarOutput<T>::TimeSeriesColumnarOutput(size_t cColumns) :
+    values(cColumns),
+    validity(cColumns) {
+}
+
+template <typename T>
+size_t TimeSeriesColumnarOutput<T>::size(void) const {
+    return times.size();
+}
+
+template <typename T>
+bool TimeSeriesColumnarOutput<T>::is_valid(size_t column, size_t row) const {
+    return IsValidityBitSet(validity[column].data(), row);
+}
+
+template <typename T>
+void TimeSeriesColumnarOutput<T>::clear(void) {
+    added.clear();
+    grainIds.clear();
+    times.clear();
+
+    for(auto &column : values)
+        column.clear();
+
+    for(auto &column : validity)
+        column.clear();
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesColumnarStatistics
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+TimeSeriesColumnarStatistics<T>::TimeSeriesColumnarStatistics(size_t cColumns, std::uint16_t sketchSize) :
+    _cColumns(
+        [&cColumns](void) {
+            if(cColumns == 0)
+                throw std::invalid_argument("cColumns");
+
+            return cColumns;
+        }()
+    ),
+    _sketchSize(
+        [&sketchSize](void) {
+            if(sketchSize < QuantileSketch::MinK)
+                throw std::invalid_argument("sketchSize");
+
+            return sketchSize;
+        }()
+    ),
+    _minFrequency(std::numeric_limits<std::int64_t>::max()) {
+}
+
+template <typename T>
+void TimeSeriesColumnarStatistics<T>::fit(TimeSeriesColumnarInput<T> const &input) {
+    if(input.columns.size() != _cColumns)
+        throw std::invalid_argument("input");
+
+    if(input.cRows == 0)
+        return;
+
+    if(input.pGrainIds == nullptr || input.pTimes == nullptr)
+        throw std::invalid_argument("input");
+
+    for(auto const &column : input.columns) {
+        if(column.pValues == nullptr)
+            throw std::invalid_argument("input");
+    }
+
+    for(size_t row = 0; row < input.cRows; ++row) {
+        std::uint32_t const                 grainId(input.pGrainIds[row]);
+        std::int64_t const                  time(input.pTimes[row]);
+
+        if(grainId >= _grains.size()) {
+            // The dense arrays are sized to grainId + 1, which can't be represented
+            // for the largest id
+            if(grainId == std::numeric_limits<std::uint32_t>::max())
+                throw std::invalid_argument("grainId");
+
+            _grains.resize(static_cast<size_t>(grainId) + 1, GrainStatistics{false, 0, std::vector<QuantileSketch>()});
+        }
+
+        GrainStatistics &                   grain(_grains[grainId]);
+
+        if(grain.hasLastTime) {
+            if(grain.lastTime >= time)
+                throw std::runtime_error("Input stream not in chronological order.");
+
+            std::int64_t const              frequency(time - grain.lastTime);
+
+            if(frequency < _minFrequency)
+                _minFrequency = frequency;
+        }
+        else {
+            grain.hasLastTime = true;
+            grain.sketches.resize(_cColumns, QuantileSketch(_sketchSize));
+        }
+
+        grain.lastTime = time;
+
+        for(size_t column = 0; column < _cColumns; ++column) {
+            TimeSeriesValueColumn<T> const &    values(input.columns[column]);
+
+            if(IsValidityBitSet(values.pValidity, row) == false)
+                continue;
+
+            grain.sketches[column].update(static_cast<double>(values.pValues[row]));
+        }
+    }
+}
+
+template <typename T>
+std::int64_t TimeSeriesColumnarStatistics<T>::get_frequency(void) const {
+    if(_minFrequency == std::numeric_limits<std::int64_t>::max())
+        throw std::runtime_error("Frequency couldn't be inferred from training data.");
+
+    return _minFrequency;
+}
+
+template <typename T>
+typename TimeSeriesColumnarStatistics<T>::MedianValues TimeSeriesColumnarStatistics<T>::get_median_values(void) const {
+    MedianValues                            result;
+
+    result.reserve(_grains.size());
+
+    for(auto const &grain : _grains) {
+        result.emplace_back();
+
+        if(grain.hasLastTime == false)
+            continue;
+
+        std::vector<T> &                    medians(result.back());
+
+        medians.reserve(_cColumns);
+
+        for(size_t column = 0; column < _cColumns; ++column) {
+            if(grain.sketches[column].empty())
+                throw std::runtime_error("No valid value found for median computation.");
+
+            medians.emplace_back(static_cast<T>(grain.sketches[column].median()));
+        }
+    }
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesColumnarImputer
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+TimeSeriesColumnarImputer<T>::TimeSeriesColumnarImputer(
+    std::int64_t frequency,
+    size_t cColumns,
+    TimeSeriesImputeStrategy strategy,
+    bool suppressError,
+    MedianValues medianValues
+) :
+    Frequency(
+        [&frequency](void) {
+            if(frequency <= 0)
+                throw std::invalid_argument("frequency");
+
+            return frequency;
+        }()
+    ),
+    NumColumns(
+        [&cColumns](void) {
+            if(cColumns == 0)
+                throw std::invalid_argument("cColumns");
+
+            return cColumns;
+        }()
+    ),
+    Strategy(
+        [&strategy](void) {
+            if(
+                strategy != TimeSeriesImputeStrategy::Forward
+                && strategy != TimeSeriesImputeStrategy::Backward
+                && strategy != TimeSeriesImputeStrategy::Median
+                && strategy != TimeSeriesImputeStrategy::Interpolate
+            )
+                throw std::invalid_argument("strategy");
+
+            return strategy;
+        }()
+    ),
+    SuppressError(suppressError),
+    Medians(
+        std::move(
+            [&medianValues, &cColumns](void) -> MedianValues & {
+                for(auto const &medians : medianValues) {
+                    if(medians.empty() == false && medians.size() != cColumns)
+                        throw std::invalid_argument("medianValues");
+                }
+
+                return medianValues;
+            }()
+        )
+    ) {
+}
+
+template <typename T>
+void TimeSeriesColumnarImputer<T>::execute(InputType const &input, OutputType &output) {
+    if(input.columns.size() != NumColumns)
+        throw std::invalid_argument("input");
+
+    if(output.values.size() != NumColumns || output.validity.size() != NumColumns)
+        throw std::invalid_argument("output");
+
+    if(input.cRows == 0)
+        return;
+
+    if(input.pGrainIds == nullptr || input.pTimes == nullptr)
+        throw std::invalid_argument("input");
+
+    for(auto const &column : input.columns) {
+        if(column.pValues == nullptr)
+            throw std::invalid_argument("input");
+    }
+
+    for(size_t row = 0; row < input.cRows; ++row) {
+        std::uint32_t const                 grainId(input.pGrainIds[row]);
+        std::int64_t const                  time(input.pTimes[row]);
+        GrainState &                        state(get_grain(grainId));
+
+        if(state.hasLastRow) {
+            if(time < state.lastTime)
+                throw std::runtime_error("Input stream not in chronological order.");
+
+            // Generate rows for the gap between the last row and this one
+            for(std::int64_t addedTime = state.lastTime + Frequency; addedTime < time; addedTime += Frequency) {
+                if(Strategy == TimeSeriesImputeStrategy::Backward || Strategy == TimeSeriesImputeStrategy::Interpolate)
+                    add_pending(state, addedTime, true, nullptr, 0);
+                else
+                    ffill_or_median(state, grainId, addedTime, true, nullptr, 0, output);
+            }
+        }
+
+        state.hasLastRow = true;
+        state.lastTime = time;
+
+        if(Strategy == TimeSeriesImputeStrategy::Backward || Strategy == TimeSeriesImputeStrategy::Interpolate) {
+            add_pending(state, time, false, &input, row);
+
+            // Rows can be emitted once every column holds a value
+            std::uint64_t                   end(state.pendingBase + state.pendingTimes.size());
+
+            for(auto const &nullStart : state.nullStart) {
+                if(nullStart < end)
+                    end = nullStart;
+            }
+
+            emit_pending(state, grainId, end, output);
+        }
+        else
+            ffill_or_median(state, grainId, time, false, &input, row, output);
+    }
+}
+
+template <typename T>
+void TimeSeriesColumnarImputer<T>::flush(OutputType &output) {
+    if(output.values.size() != NumColumns || output.validity.size() != NumColumns)
+        throw std::invalid_argument("output");
+
+    for(size_t grainId = 0; grainId < _grains.size(); ++grainId) {
+        GrainState &                        state(_grains[grainId]);
+
+        emit_pending(state, static_cast<std::uint32_t>(grainId), state.pendingBase + state.pendingTimes.size(), output);
+    }
+
+    // Clear the working state
+    _grains.clear();
+}
+
+template <typename T>
+typename TimeSeriesColumnarImputer<T>::GrainState & TimeSeriesColumnarImputer<T>::get_grain(std::uint32_t grainId) {
+    if(grainId >= _grains.size()) {
+        // The dense arrays are sized to grainId + 1, which can't be represented
+        // for the largest id
+        if(grainId == std::numeric_limits<std::uint32_t>::max())
+            throw std::invalid_argument("grainId");
+
+        size_t const                        cGrains(static_cast<size_t>(grainId) + 1);
+
+        _grains.reserve(cGrains);
+
+        while(_grains.size() < cGrains) {
+            _grains.emplace_back(
+                GrainState{
+                    false,
+                    0,
+                    std::vector<T>(NumColumns, T()),
+                    std::vector<std::uint8_t>(NumColumns, 0),
+                    std::vector<std::int64_t>(NumColumns, 0),
+                    0,
+                    std::deque<std::int64_t>(),
+                    std::deque<std::uint8_t>(),
+                    std::deque<T>(),
+                    std::deque<std::uint8_t>(),
+                    std::vector<std::uint64_t>(NumColumns, 0)
+                }
+            );
+        }
+    }
+
+    return _grains[grainId];
+}
+
+template <typename T>
+void TimeSeriesColumnarImputer<T>::ffill_or_median(GrainState &state, std::uint32_t grainId, std::int64_t time, bool added, InputType const *pInput, size_t row, OutputType &output) {
+    std::vector<T> const *                  pMedians(nullptr);
+
+    if(Strategy == TimeSeriesImputeStrategy::Median && grainId < Medians.size() && Medians[grainId].empty() == false)
+        pMedians = &Medians[grainId];
+
+    size_t const                            outputRow(output.size());
+
+    output.added.push_back(added ? 1 : 0);
+    output.grainIds.push_back(grainId);
+    output.times.push_back(time);
+
+    for(size_t column = 0; column < NumColumns; ++column) {
+        T                                   value = T();
+        bool                                isValid(false);
+
+        if(pInput && IsValidityBitSet(pInput->columns[column].pValidity, row)) {
+            value = pInput->columns[column].pValues[row];
+            isValid = true;
+        }
+        else if(Strategy == TimeSeriesImputeStrategy::Forward) {
+            value = state.lastValues[column];
+            isValid = state.lastValid[column] != 0;
+        }
+        else if(pMedians) {
+            value = (*pMedians)[column];
+            isValid = true;
+        }
+        else if(SuppressError == false)
+            throw std::runtime_error("Invalid key");
+
+        state.lastValues[column] = value;
+        state.lastValid[column] = isValid ? 1 : 0;
+
+        output.values[column].push_back(value);
+        AppendValidityBit(output.validity[column], outputRow, isValid);
+    }
+}
+
+template <typename T>
+void TimeSeriesColumnarImputer<T>::add_pending(GrainState &state, std::int64_t time, bool added, InputType const *pInput, size_t row) {
+    std::uint64_t const                     pendingRow(state.pendingBase + state.pendingTimes.size());
+
+    state.pendingTimes.push_back(time);
+    state.pendingAdded.push_back(added ? 1 : 0);
+
+    for(size_t column = 0; column < NumColumns; ++column) {
+        std::uint64_t &                     nullStart(state.nullStart[column]);
+
+        if(pInput == nullptr || IsValidityBitSet(pInput->columns[column].pValidity, row) == false) {
+            state.pendingValues.push_back(T());
+            state.pendingValid.push_back(0);
+
+            // Nulls before the first value are never interpolated
+            if(Strategy == TimeSeriesImputeStrategy::Interpolate && state.lastValid[column] == 0)
+                nullStart = pendingRow + 1;
+
+            continue;
+        }
+
+        T const &                           value(pInput->columns[column].pValues[row]);
+
+        state.pendingValues.push_back(value);
+        state.pendingValid.push_back(1);
+
+        // Fill the trailing nulls in this column; each value is imputed once
+        if(Strategy == TimeSeriesImputeStrategy::Interpolate) {
+            if(state.lastValid[column]) {
+                double const                anchorValue(static_cast<double>(state.lastValues[column]));
+                std::int64_t const          anchorTime(state.lastValueTimes[column]);
+                double const                span(static_cast<double>(time - anchorTime));
+
+                while(nullStart < pendingRow) {
+                    size_t const            offset(static_cast<size_t>(nullStart - state.pendingBase));
+                    double const            weight(span > 0 ? static_cast<double>(state.pendingTimes[offset] - anchorTime) / span : 1.0);
+                    size_t const            index(offset * NumColumns + column);
+
+                    state.pendingValues[index] = static_cast<T>(anchorValue + (static_cast<double>(value) - anchorValue) * weight);
+                    state.pendingValid[index] = 1;
+                    ++nullStart;
+                }
+            }
+
+            state.lastValues[column] = value;
+            state.lastValid[column] = 1;
+            state.lastValueTimes[column] = time;
+        }
+        else {
+            while(nullStart < pendingRow) {
+                size_t const                index(static_cast<size_t>(nullStart - state.pendingBase) * NumColumns + column);
+
+                state.pendingValues[index] = value;
+                state.pendingValid[index] = 1;
+                ++nullStart;
+            }
+        }
+
+        nullStart = pendingRow + 1;
+    }
+}
+
+template <typename T>
+void TimeSeriesColumnarImputer<T>::emit_pending(GrainState &state, std::uint32_t grainId, std::uint64_t end, OutputType &output) {
+    while(state.pendingBase < end) {
+        size_t const                        outputRow(output.size());
+
+        output.added.push_back(state.pendingAdded.front());
+        output.grainIds.push_back(grainId);
+        output.times.push_back(state.pendingTimes.front());
+
+        for(size_t column = 0; column < NumColumns; ++column) {
+            output.values[column].push_back(state.pendingValues[column]);
+            AppendValidityBit(output.validity[column], outputRow, state.pendingValid[column] != 0);
+        }
+
+        state.pendingAdded.pop_front();
+        state.pendingTimes.pop_front();
+        state.pendingValues.erase(state.pendingValues.begin(), state.pendingValues.begin() + static_cast<std::ptrdiff_t>(NumColumns));
+        state.pendingValid.erase(state.pendingValid.begin(), state.pendingValid.begin() + static_cast<std::ptrdiff_t>(NumColumns));
+        ++state.pendingBase;
+    }
+
+    // Columns without trailing nulls point at the end of the pending rows
+    for(auto &nullStart : state.nullStart) {
+        if(nullStart < state.pendingBase)
+            nullStart = state.pendingBase;
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -8,6 +8,8 @@
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 #include "../Components/PipelineExecutionEstimatorImpl.h"
+#include "GrainInterner.h"
+#include "GrainPartitioner.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -53,6 +55,10 @@ public:
 ///                 timepoints for a given grain. Note that frequency is same for
 ///                 complete dataset.
 ///
+///                 When `numThreads` is greater than 1, each batch passed to
+///                 fit is partitioned by grain and the partitions are processed
+///                 in parallel, each producing its own minimum.
+///
 class TimeSeriesFrequencyEstimator : public FitEstimator<std::tuple<std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> {
 public:
     // ----------------------------------------------------------------------
@@ -60,7 +66,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesFrequencyEstimator(AnnotationMapsPtr pAllColumnAnnotations);
+    TimeSeriesFrequencyEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::uint32_t numThreads=1);
     ~TimeSeriesFrequencyEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesFrequencyEstimator);
@@ -76,14 +82,20 @@ private:
     using BaseType                          = FitEstimator<std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType>>;
     using FrequencyType                     = std::chrono::system_clock::duration;
     using TimePointType                     = std::chrono::system_clock::time_point;
-    using MapType                           = std::map<KeyType, TimePointType>;
+
+    struct GrainTimeState {
+        bool                                hasLastTime;
+        TimePointType                       lastTime;
+    };
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    MapType                                 _grainTimePointTracker;
+    std::uint32_t const                     _numThreads;
+    GrainInterner                           _grainInterner;
+    std::vector<GrainTimeState>             _grainTimePointTracker;     // Indexed by grain id
     FrequencyType                           _minFrequency;
 
     // ----------------------------------------------------------------------
@@ -96,6 +108,10 @@ private:
     FitResult fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) override;
 
     void complete_training_impl(void) override;
+
+    GrainInterner::IdType intern_grain(KeyType const &key);
+
+    static void update_grain(GrainTimeState &grain, TimePointType const &timeValue, FrequencyType &minFrequency);
 };
 
 
@@ -124,8 +140,9 @@ inline TimeSeriesFrequencyAnnotation::TimeSeriesFrequencyAnnotation(TimeSeriesFr
 // |  TimeSeriesFrequencyEstimator
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesFrequencyEstimator::TimeSeriesFrequencyEstimator(AnnotationMapsPtr pAllColumnAnnotations) :
+inline TimeSeriesFrequencyEstimator::TimeSeriesFrequencyEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::uint32_t numThreads) :
     BaseType("TimeSeriesFrequencyEstimator", std::move(pAllColumnAnnotations))
+    ,_numThreads(numThreads)
     ,_minFrequency(std::chrono::system_clock::duration::max().count()){
 }
 
@@ -137,38 +154,80 @@ inline bool TimeSeriesFrequencyEstimator::begin_training_impl(void) /*override*/
 }
 
 inline FitResult TimeSeriesFrequencyEstimator::fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) {
-    typename BaseType::InputType const * const          pEndBuffer(pBuffer + cBuffer);
-
-    while(pBuffer != pEndBuffer) {
-        std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType> const &        input(*pBuffer++);
-        TimePointType const &                                           timeValue (std::get<0>(input));
-        KeyType const &                                                 keyValues (std::get<1>(input));
-        typename MapType::iterator const                                iter(_grainTimePointTracker.find(keyValues));
-
-        if(iter == _grainTimePointTracker.end())
-            _grainTimePointTracker.insert(std::make_pair(keyValues, timeValue));
-        else
-        {
-            TimePointType const &                                       lastObservedTimeValue(iter->second);
-            if(lastObservedTimeValue >= timeValue)
-                throw std::runtime_error("Input stream not in chronological order.");
-
-            FrequencyType                                               currentFrequency(timeValue-lastObservedTimeValue);
-            if(currentFrequency <= _minFrequency)
-                _minFrequency = currentFrequency;
-
-            iter->second = timeValue;
+    if(_numThreads == 1) {
+        typename BaseType::InputType const * const          pEndBuffer(pBuffer + cBuffer);
+
+        while(pBuffer != pEndBuffer) {
+            std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType> const &        input(*pBuffer++);
+
+            update_grain(_grainTimePointTracker[intern_grain(std::get<1>(input))], std::get<0>(input), _minFrequency);
         }
+
+        return FitResult::Continue;
+    }
+
+    // Grains are interned up front so that _grainTimePointTracker doesn't change
+    // while the partitions are being processed.
+    GrainPartitions const                   partitions(
+        PartitionByGrain(
+            cBuffer,
+            [this, pBuffer](size_t row) {
+                return intern_grain(std::get<1>(pBuffer[row]));
+            }
+        )
+    );
+    std::vector<FrequencyType>              minFrequencies(partitions.size(), FrequencyType::max());
+
+    ParallelForEach(
+        partitions.size(),
+        _numThreads,
+        [this, pBuffer, &partitions, &minFrequencies](size_t partition) {
+            GrainTimeState &                grain(_grainTimePointTracker[partitions.GrainIds[partition]]);
+
+            for(size_t offset = partitions.Offsets[partition]; offset < partitions.Offsets[partition + 1]; ++offset)
+                update_grain(grain, std::get<0>(pBuffer[partitions.RowIndexes[offset]]), minFrequencies[partition]);
+        }
+    );
+
+    for(FrequencyType const &frequency : minFrequencies) {
+        if(frequency < _minFrequency)
+            _minFrequency = frequency;
     }
 
     return FitResult::Continue;
 }
 
 inline void TimeSeriesFrequencyEstimator::complete_training_impl(void) {
+    _grainInterner.clear();
+    _grainTimePointTracker.clear();
 
     BaseType::add_annotation(std::make_shared<TimeSeriesFrequencyAnnotation>(std::move(_minFrequency)), 0);
 }
 
+inline GrainInterner::IdType TimeSeriesFrequencyEstimator::intern_grain(KeyType const &key) {
+    GrainInterner::IdType const             grainId(_grainInterner.intern(key));
+
+    if(grainId == _grainTimePointTracker.size())
+        _grainTimePointTracker.emplace_back(GrainTimeState{false, TimePointType()});
+
+    return grainId;
+}
+
+inline /*static*/ void TimeSeriesFrequencyEstimator::update_grain(GrainTimeState &grain, TimePointType const &timeValue, FrequencyType &minFrequency) {
+    if(grain.hasLastTime) {
+        if(grain.lastTime >= timeValue)
+            throw std::runtime_error("Input stream not in chronological order.");
+
+        FrequencyType                       currentFrequency(timeValue - grain.lastTime);
+
+        if(currentFrequency <= minFrequency)
+            minFrequency = currentFrequency;
+    }
+
+    grain.hasLastTime = true;
+    grain.lastTime = timeValue;
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -8,8 +8,12 @@
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 #include "PipelineExecutionEstimatorImpl.h"
+#include "GrainInterner.h"
 #include "TimeSeriesFrequencyEstimator.h"
 #include "TimeSeriesMedianEstimator.h"
+#include "GrainPartitioner.h"
+
+#include <deque>
 
 namespace Microsoft {
 namespace Featurizer {
@@ -20,7 +24,7 @@ enum class TimeSeriesImputeStrategy : uint8_t {
     Forward = 1,                            ///< TODO: Document this
     Backward,                               ///< TODO: Document this
     Median,                                 ///< TODO: Document this
-    Interpolate,                            ///< TODO: Document this
+    Interpolate,                            ///< Linear interpolation between the closest values before and after, weighted by time
 
     NumValues
 };
@@ -32,6 +36,24 @@ inline bool IsValid(TimeSeriesImputeStrategy value) {
         || value == TimeSeriesImputeStrategy::Interpolate;
 }
 
+/////////////////////////////////////////////////////////////////////////
+///  \enum          TimeSeriesLookaheadPolicy
+///  \brief         Behavior when a row imputed with the Backward or Interpolate
+///                 strategies is still waiting for a value after the maximum
+///                 number of rows that may follow it in its grain.
+///
+enum class TimeSeriesLookaheadPolicy : uint8_t {
+    EmitAsNull = 1,                         ///< The row is emitted with the values that couldn't be imputed set to null
+    Error,                                  ///< An exception is thrown
+
+    NumValues
+};
+
+inline bool IsValid(TimeSeriesLookaheadPolicy value) {
+    return value == TimeSeriesLookaheadPolicy::EmitAsNull
+        || value == TimeSeriesLookaheadPolicy::Error;
+}
+
 using TimeSeriesImputerEstimatorInputType = std::tuple<
     std::chrono::system_clock::time_point,
     std::vector<std::string>,
@@ -79,7 +101,15 @@ public:
         // |  Public Methods
         // |
         // ----------------------------------------------------------------------
-        Transformer(FrequencyType value, std::vector<TypeId> colsToImputeDataTypes, TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, std::map<KeyType,std::vector<double_t>> medianValues);
+        Transformer(
+            FrequencyType value,
+            std::vector<TypeId> colsToImputeDataTypes,
+            TimeSeriesImputeStrategy tsImputeStrategy,
+            bool supressError,
+            std::map<KeyType,std::vector<double_t>> medianValues,
+            std::uint32_t maxLookahead=std::numeric_limits<std::uint32_t>::max(),
+            TimeSeriesLookaheadPolicy lookaheadPolicy=TimeSeriesLookaheadPolicy::EmitAsNull
+        );
         Transformer(Archive & ar);
         ~Transformer(void) override = default;
 
@@ -89,6 +119,12 @@ public:
 
         void save(Archive & ar) const override;
 
+        /// Imputes a batch of rows, processing the grains of the batch in parallel
+        /// on up to `numThreads` threads (0 uses the hardware concurrency). Output
+        /// is produced grain by grain, in the order that each grain first appears in
+        /// the batch, and chronologically within each grain.
+        void execute_batch(typename ThisBaseType::InputType const *pBuffer, size_t cBuffer, typename ThisBaseType::CallbackFunction const &callback, std::uint32_t numThreads=0);
+
         // ----------------------------------------------------------------------
         // |
         // |  Public Data
@@ -97,17 +133,64 @@ public:
         FrequencyType const                             _frequency;
         std::vector<TypeId> const                       _colsToImputeDataTypes;
         TimeSeriesImputeStrategy const                  _tsImputeStrategy;
-        std::map<KeyType,std::vector<double_t>> const   _medianValues;
+        // Not const so that it is moved (rather than copied) when the Transformer
+        // is moved; GrainState::pMedianValues points into the map's nodes.
+        std::map<KeyType,std::vector<double_t>>         _medianValues;
         bool const                                      _supressError;
 
+        // Maximum number of rows in a grain that may follow a row that is
+        // waiting for a value (Backward and Interpolate).
+        std::uint32_t const                             _maxLookahead;
+        TimeSeriesLookaheadPolicy const                 _lookaheadPolicy;
+
     private:
+        // ----------------------------------------------------------------------
+        // |
+        // |  Private Types
+        // |
+        // ----------------------------------------------------------------------
+
+        // A row of a grain; the grain itself is only copied into the row when it
+        // is emitted.
+        struct ImputedRow {
+            bool                                            isAdded;
+            TimePointType                                   timePoint;
+            ColsToImputeType                                values;
+        };
+
+        // Rows of a grain waiting for the next value of a column (Backward and
+        // Interpolate). Each column is null for the rows in
+        // [nullStart[column], pendingBase + pendingRows.size()) and resolved for the
+        // rows before that, so every value is imputed exactly once. Memory is bounded
+        // by the longest gap and by _maxLookahead.
+        struct PendingState {
+            std::uint64_t                                   pendingBase;
+            std::deque<ImputedRow>                          pendingRows;
+            std::vector<std::uint64_t>                      nullStart;
+
+            // Interpolate: last value seen for each column
+            std::vector<bool>                               hasAnchor;
+            std::vector<double_t>                           anchorValues;
+            std::vector<TimePointType>                      anchorTimes;
+        };
+
+        // Working state for a grain, indexed by the id assigned by _grainInterner
+        struct GrainState {
+            KeyType const *                                 pGrain;                 // Owned by _grainInterner
+            bool                                            hasLastRow;
+            TimePointType                                   lastTimePoint;
+            ColsToImputeType                                lastValues;             // Forward
+            std::vector<double_t> const *                   pMedianValues;          // Owned by _medianValues; nullptr if the grain wasn't seen during training
+            PendingState                                    pending;                // Backward and Interpolate
+        };
+
         // ----------------------------------------------------------------------
         // |
         // |  Private Data
         // |
         // ----------------------------------------------------------------------
-        std::map<KeyType,OutputRowType>                                     _lastRowtracker;
-        std::map<KeyType,std::vector<BaseType::TransformedType>>            _buffer;
+        GrainInterner                                                       _grainInterner;
+        std::vector<GrainState>                                             _grains;
 
         // ----------------------------------------------------------------------
         // |
@@ -117,11 +200,14 @@ public:
         void execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) override;
         void flush_impl(typename ThisBaseType::CallbackFunction const &callback) override;
 
-        std::vector<typename BaseType::TransformedType> generate_rows(typename ThisBaseType::InputType const &input, TimePointType const & lastObservedTP);
-        void impute(ColsToImputeType & prev, ColsToImputeType & current);
-        bool no_nulls(ColsToImputeType const & input);
-        void bfill(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
-        void ffill_or_median(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
+        GrainInterner::IdType intern_grain(KeyType const &key);
+        void execute_row(GrainState &grain, typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
+
+        void impute_row(GrainState &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback);
+        void ffill_or_median(GrainState &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback);
+        void bfill_or_interpolate(GrainState &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback);
+
+        static void emit(GrainState const &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback);
     };
 
     using TransformerType                   = Transformer;
@@ -131,7 +217,14 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError);
+    TimeSeriesImputerEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        std::vector<TypeId> colsToImputeDataTypes,
+        TimeSeriesImputeStrategy tsImputeStrategy,
+        bool supressError,
+        std::uint32_t maxLookahead=std::numeric_limits<std::uint32_t>::max(),
+        TimeSeriesLookaheadPolicy lookaheadPolicy=TimeSeriesLookaheadPolicy::EmitAsNull
+    );
     ~TimeSeriesImputerEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesImputerEstimator);
@@ -151,6 +244,8 @@ private:
     std::vector<TypeId> const                       _colsToImputeDataTypes;
     TimeSeriesImputeStrategy const                  _tsImputeStrategy;
     bool const                                      _supressError;
+    std::uint32_t const                             _maxLookahead;
+    TimeSeriesLookaheadPolicy const                 _lookaheadPolicy;
 
     // ----------------------------------------------------------------------
     // |
@@ -185,7 +280,7 @@ private:
         assert(dynamic_cast<TimeSeriesMedianAnnotation const *>(&medianAnnotation));
         TimeSeriesMedianAnnotation const &              tsMedianAnnotation(static_cast<TimeSeriesMedianAnnotation const &>(medianAnnotation));
 
-        return typename BaseType::TransformerUniquePtr(new Transformer(tsFreqAnnotation.Value, std::move(_colsToImputeDataTypes), std::move(_tsImputeStrategy), std::move(_supressError), tsMedianAnnotation.Value));
+        return typename BaseType::TransformerUniquePtr(new Transformer(tsFreqAnnotation.Value, std::move(_colsToImputeDataTypes), std::move(_tsImputeStrategy), std::move(_supressError), tsMedianAnnotation.Value, _maxLookahead, _lookaheadPolicy));
     }
 };
 
@@ -204,7 +299,7 @@ private:
 // |  TimeSeriesImputerEstimator
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy,bool supressError) :
+inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy,bool supressError,std::uint32_t maxLookahead,TimeSeriesLookaheadPolicy lookaheadPolicy) :
     BaseType("TimeSeriesImputerEstimator", std::move(pAllColumnAnnotations)),
     _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
     _tsImputeStrategy(
@@ -217,7 +312,16 @@ inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr
             }()
         )
     ),
-    _supressError(std::move(supressError)) {
+    _supressError(std::move(supressError)),
+    _maxLookahead(std::move(maxLookahead)),
+    _lookaheadPolicy(
+        [&lookaheadPolicy](void) {
+            if(IsValid(lookaheadPolicy) == false)
+                throw std::invalid_argument("'lookaheadPolicy' is not valid");
+
+            return lookaheadPolicy;
+        }()
+    ) {
 
         if(_tsImputeStrategy == TimeSeriesImputeStrategy::Median && _supressError == false) {
             // Verify that all col types are double/float
@@ -227,6 +331,14 @@ inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr
             }
         }
 
+        if(_tsImputeStrategy == TimeSeriesImputeStrategy::Interpolate && _supressError == false) {
+            // Verify that all col types are double/float
+            for(auto const & colType : _colsToImputeDataTypes) {
+                if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(colType) == false)
+                    throw std::runtime_error("Only Numeric type columns are supported for ImputationStrategy interpolate. (use suppressError flag to skip imputing non-numeric types)");
+            }
+        }
+
 }
 
 inline bool TimeSeriesImputerEstimator::begin_training_impl(void) /*override*/ {
@@ -241,12 +353,21 @@ inline void TimeSeriesImputerEstimator::complete_training_impl(void) /*override
 // |  TimeSeriesImputerEstimator::Transformer
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEstimator::FrequencyType value, std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, std::map<KeyType,std::vector<double_t>> medianValues) :
+inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEstimator::FrequencyType value, std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, std::map<KeyType,std::vector<double_t>> medianValues, std::uint32_t maxLookahead, TimeSeriesLookaheadPolicy lookaheadPolicy) :
     _frequency(std::move(value)),
     _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
     _tsImputeStrategy(std::move(tsImputeStrategy)),
     _medianValues(std::move(medianValues)),
-    _supressError(std::move(supressError)) {
+    _supressError(std::move(supressError)),
+    _maxLookahead(std::move(maxLookahead)),
+    _lookaheadPolicy(
+        [&lookaheadPolicy](void) {
+            if(IsValid(lookaheadPolicy) == false)
+                throw std::invalid_argument("lookaheadPolicy");
+
+            return lookaheadPolicy;
+        }()
+    ) {
 
     if(_colsToImputeDataTypes.size() == 0)
         throw std::runtime_error("Column metadata can't be empty.");
@@ -263,7 +384,8 @@ inline TimeSeriesImputerEstimator::Transformer::Transformer(Archive & ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            // Version 1.0 archives don't contain the lookahead settings
+            if(majorVersion != 1 || minorVersion > 1)
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
@@ -307,13 +429,22 @@ inline TimeSeriesImputerEstimator::Transformer::Transformer(Archive & ar) :
 
             std::map<KeyType, std::vector<double_t>>    medianValues(Traits<std::map<KeyType, std::vector<double_t>>>::deserialize(ar));
             bool                                        suppressError(Traits<bool>::deserialize(ar));
+            std::uint32_t                               maxLookahead(std::numeric_limits<std::uint32_t>::max());
+            TimeSeriesLookaheadPolicy                   lookaheadPolicy(TimeSeriesLookaheadPolicy::EmitAsNull);
+
+            if(minorVersion >= 1) {
+                maxLookahead = Traits<std::uint32_t>::deserialize(ar);
+                lookaheadPolicy = static_cast<TimeSeriesLookaheadPolicy>(Traits<std::underlying_type<TimeSeriesLookaheadPolicy>::type>::deserialize(ar));
+            }
 
             return Transformer(
                 std::move(duration),
                 std::move(colsToImputeTypes),
                 std::move(strategy),
                 std::move(suppressError),
-                std::move(medianValues)
+                std::move(medianValues),
+                std::move(maxLookahead),
+                std::move(lookaheadPolicy)
             );
         }()
     ) {
@@ -324,13 +455,15 @@ inline bool TimeSeriesImputerEstimator::Transformer::operator==(Transformer cons
         && _colsToImputeDataTypes == other._colsToImputeDataTypes
         && _tsImputeStrategy == other._tsImputeStrategy
         && _medianValues == other._medianValues
-        && _supressError == other._supressError;
+        && _supressError == other._supressError
+        && _maxLookahead == other._maxLookahead
+        && _lookaheadPolicy == other._lookaheadPolicy;
 }
 
 inline void TimeSeriesImputerEstimator::Transformer::save(Archive & ar) const {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, 1); // Minor
 
     // Data
 
@@ -357,169 +490,297 @@ inline void TimeSeriesImputerEstimator::Transformer::save(Archive & ar) const {
 
     //_supressError
     Traits<bool>::serialize(ar,_supressError);
+
+    //_maxLookahead
+    Traits<std::uint32_t>::serialize(ar,_maxLookahead);
+
+    //_lookaheadPolicy
+    Traits<std::underlying_type<TimeSeriesLookaheadPolicy>::type>::serialize(ar,static_cast<std::underlying_type<TimeSeriesLookaheadPolicy>::type>(_lookaheadPolicy));
 }
 
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+inline void TimeSeriesImputerEstimator::Transformer::execute_batch(typename ThisBaseType::InputType const *pBuffer, size_t cBuffer, typename ThisBaseType::CallbackFunction const &callback, std::uint32_t numThreads) {
+    if(pBuffer == nullptr && cBuffer != 0)
+        throw std::invalid_argument("pBuffer");
+    if(!callback)
+        throw std::invalid_argument("callback");
+
+    // Grains are interned up front so that _grains doesn't change while the
+    // partitions are being processed; each partition only touches the state of
+    // its own grain.
+    GrainPartitions const                                                   partitions(
+        PartitionByGrain(
+            cBuffer,
+            [this, pBuffer](size_t row) {
+                return intern_grain(std::get<1>(pBuffer[row]));
+            }
+        )
+    );
+    std::vector<std::vector<typename ThisBaseType::TransformedType>>        results(partitions.size());
+
+    ParallelForEach(
+        partitions.size(),
+        numThreads,
+        [this, pBuffer, &partitions, &results](size_t partition) {
+            GrainState &                                                    grain(_grains[partitions.GrainIds[partition]]);
+            std::vector<typename ThisBaseType::TransformedType> &           output(results[partition]);
+            typename ThisBaseType::CallbackFunction const                   partitionCallback(
+                [&output](typename ThisBaseType::TransformedType value) {
+                    output.emplace_back(std::move(value));
+                }
+            );
+
+            for(size_t offset = partitions.Offsets[partition]; offset < partitions.Offsets[partition + 1]; ++offset)
+                execute_row(grain, pBuffer[partitions.RowIndexes[offset]], partitionCallback);
+        }
+    );
+
+    for(auto &output : results) {
+        for(auto &row : output)
+            callback(std::move(row));
+    }
+}
+
 inline void TimeSeriesImputerEstimator::Transformer::execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
-    // Ensure that this row is in chronological order
-    KeyType const &                                                         key(std::get<1>(input));
-    std::map<KeyType, OutputRowType>::const_iterator const                  iterLastRow(_lastRowtracker.find(key));
+    execute_row(_grains[intern_grain(std::get<1>(input))], input, callback);
+}
+
+inline GrainInterner::IdType TimeSeriesImputerEstimator::Transformer::intern_grain(KeyType const &key) {
+    GrainInterner::IdType const                                             grainId(_grainInterner.intern(key));
+
+    if(grainId == _grains.size()) {
+        std::map<KeyType, std::vector<double_t>>::const_iterator const      iterMedian(_medianValues.find(key));
+
+        _grains.emplace_back(
+            GrainState{
+                &_grainInterner.get(grainId),
+                false,
+                TimePointType(),
+                ColsToImputeType(),
+                iterMedian == _medianValues.end() ? nullptr : &iterMedian->second,
+                PendingState()
+            }
+        );
+    }
+
+    return grainId;
+}
 
-    if(iterLastRow != _lastRowtracker.end()) {
-        std::chrono::system_clock::time_point const &   lastRowTimePoint(std::get<1>(iterLastRow->second));
-        std::chrono::system_clock::time_point const &   inputTimePoint(std::get<0>(input));
+inline void TimeSeriesImputerEstimator::Transformer::execute_row(GrainState &grain, typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
+    TimePointType const &                   inputTimePoint(std::get<0>(input));
+    ColsToImputeType const &                inputValues(std::get<2>(input));
 
-        if(inputTimePoint < lastRowTimePoint)
+    if(grain.hasLastRow) {
+        // Ensure that this row is in chronological order
+        if(inputTimePoint < grain.lastTimePoint)
             throw std::runtime_error("Input stream not in chronological order.");
+
+        // Rows missing between the last row and this one are generated and
+        // imputed one at a time
+        for(TimePointType timePoint = grain.lastTimePoint + _frequency; timePoint < inputTimePoint; timePoint += _frequency) {
+            impute_row(grain, ImputedRow{true, timePoint, ColsToImputeType(inputValues.size())}, callback);
+            grain.lastTimePoint = timePoint;
+        }
     }
 
+    impute_row(grain, ImputedRow{false, inputTimePoint, inputValues}, callback);
+
+    grain.hasLastRow = true;
+    grain.lastTimePoint = inputTimePoint;
+}
+
+inline void TimeSeriesImputerEstimator::Transformer::impute_row(GrainState &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback) {
     // Invoke the specified impute strategy
     if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward || _tsImputeStrategy == TimeSeriesImputeStrategy::Median)
-        ffill_or_median(input, callback);
-    else if(_tsImputeStrategy == TimeSeriesImputeStrategy::Backward)
-        bfill(input, callback);
+        ffill_or_median(grain, std::move(row), callback);
+    else if(_tsImputeStrategy == TimeSeriesImputeStrategy::Backward || _tsImputeStrategy == TimeSeriesImputeStrategy::Interpolate)
+        bfill_or_interpolate(grain, std::move(row), callback);
     else
         throw std::runtime_error("Unsupported Impute Strategy");
 }
 
 inline void TimeSeriesImputerEstimator::Transformer::flush_impl(typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
-    std::vector<typename TimeSeriesImputerEstimator::BaseType::TransformedType> output;
+    // Rows still waiting for a value can't be imputed. Grains are flushed in key order.
+    std::vector<GrainState *>               pendingGrains;
 
-    for (auto it = _buffer.begin(); it != _buffer.end(); ++it)
-        output.insert(output.end(), it->second.begin(), it->second.end());
+    for(auto &grain : _grains) {
+        if(grain.pending.pendingRows.empty() == false)
+            pendingGrains.emplace_back(&grain);
+    }
 
-    // Clear the working state
-    _lastRowtracker.clear();
-    _buffer.clear();
+    std::sort(
+        pendingGrains.begin(),
+        pendingGrains.end(),
+        [](GrainState const *pA, GrainState const *pB) {
+            return *pA->pGrain < *pB->pGrain;
+        }
+    );
+
+    for(GrainState *pGrain : pendingGrains) {
+        std::deque<ImputedRow> &            pendingRows(pGrain->pending.pendingRows);
+
+        while(pendingRows.empty() == false) {
+            emit(*pGrain, std::move(pendingRows.front()), callback);
+            pendingRows.pop_front();
+        }
+    }
 
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : output)
-        callback(std::move(addedRow));
+    // Clear the working state
+    _grains.clear();
+    _grainInterner.clear();
 }
 
-inline std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformedType> TimeSeriesImputerEstimator::Transformer::generate_rows(typename ThisBaseType::InputType const &input, typename TimeSeriesImputerEstimator::TimePointType const & lastObservedTP) {
+inline void TimeSeriesImputerEstimator::Transformer::ffill_or_median(GrainState &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback) {
+    ColsToImputeType &                      values(row.values);
 
-    std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformedType> output;
-    typename TimeSeriesImputerEstimator::TimePointType tempTP = lastObservedTP + _frequency;
-    typename TimeSeriesImputerEstimator::TimePointType inputTP = std::get<0>(input);
+    if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward) {
+        if(row.isAdded)
+            values = grain.lastValues;
+        else {
+            if(grain.hasLastRow) {
+                for(std::size_t colIndex = 0; colIndex < values.size(); ++colIndex) {
+                    if(StrTraits::IsNull(values[colIndex]))
+                        values[colIndex] = grain.lastValues[colIndex];
+                }
+            }
 
-    while(tempTP < inputTP) {
-        output.push_back(std::make_tuple(true, tempTP, std::get<1>(input), ColsToImputeType(std::get<2>(input).size())));
-        tempTP = tempTP + _frequency;
+            grain.lastValues = values;
+        }
     }
+    else {
+        std::vector<double_t> const * const pMedianValues(grain.pMedianValues);
 
-    output.push_back(std::tuple_cat(std::make_tuple(false), input));
+        for(std::size_t colIndex = 0; colIndex < values.size(); ++colIndex) {
+            if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(_colsToImputeDataTypes[colIndex]) == false)
+                continue;
 
-    return output;
-}
+            if(StrTraits::IsNull(values[colIndex])) {
+                if(pMedianValues == nullptr) {
+                    if(_supressError)
+                        continue;
 
-inline void TimeSeriesImputerEstimator::Transformer::impute(typename TimeSeriesImputerEstimator::ColsToImputeType & prev, typename TimeSeriesImputerEstimator::ColsToImputeType & current) {
+                    throw std::runtime_error("Invalid key");
+                }
 
-    for(std::size_t i=0; i< current.size(); ++i)
-        if(StrTraits::IsNull(current[i]))
-            current[i] = prev[i];
-}
+                assert(colIndex < pMedianValues->size());
+                values[colIndex] = Traits<std::double_t>::ToString((*pMedianValues)[colIndex]);
+            }
+        }
+    }
 
-inline bool TimeSeriesImputerEstimator::Transformer::no_nulls(typename TimeSeriesImputerEstimator::ColsToImputeType const & input) {
+    emit(grain, std::move(row), callback);
+}
 
-    for(std::size_t i=0; i< input.size(); ++i)
-        if(StrTraits::IsNull(input[i]))
-            return false;
+inline void TimeSeriesImputerEstimator::Transformer::bfill_or_interpolate(GrainState &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback) {
+    PendingState &                                      state(grain.pending);
 
-    return true;
-}
+    if(grain.hasLastRow == false) {
+        size_t const                                    numCols(_colsToImputeDataTypes.size());
 
-inline void TimeSeriesImputerEstimator::Transformer::bfill(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
+        state.nullStart.resize(numCols, 0);
 
-    typename TimeSeriesImputerEstimator::KeyType const & key = std::get<1>(input);
+        if(_tsImputeStrategy == TimeSeriesImputeStrategy::Interpolate) {
+            state.hasAnchor.resize(numCols, false);
+            state.anchorValues.resize(numCols, 0.0);
+            state.anchorTimes.resize(numCols);
+        }
+    }
 
-    if ( _lastRowtracker.find(key) == _lastRowtracker.end() )
-            _lastRowtracker.insert(std::make_pair(key, std::tuple_cat(std::make_tuple(false), input)));
+    std::uint64_t const                                 rowIndex(state.pendingBase + state.pendingRows.size());
+    TimePointType const                                 rowTP(row.timePoint);
+    ColsToImputeType const &                            rowData(row.values);
 
-    typename TimeSeriesImputerEstimator::OutputRowType  & lastRow = _lastRowtracker[key];
-    std::vector<TimeSeriesImputerEstimator::BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
+    for(std::size_t colIndex = 0; colIndex < rowData.size(); ++colIndex) {
+        std::uint64_t &                                 nullStart(state.nullStart[colIndex]);
 
-    if ( _buffer.find(key) != _buffer.end() )
-            _buffer[key].insert(_buffer[key].end(), addedRowsResultset.begin(), addedRowsResultset.end());
-    else
-        _buffer.insert(std::make_pair(key, addedRowsResultset));
+        if(_tsImputeStrategy == TimeSeriesImputeStrategy::Backward) {
+            if(StrTraits::IsNull(rowData[colIndex]))
+                continue;
 
-    lastRow = _buffer[key].back();
+            // Fill the trailing nulls in this column
+            while(nullStart < rowIndex) {
+                state.pendingRows[static_cast<size_t>(nullStart - state.pendingBase)].values[colIndex] = rowData[colIndex];
+                ++nullStart;
+            }
 
-    for (auto it = _buffer[key].rbegin(); it != _buffer[key].rend(); it++) {
-        impute(std::get<3>(lastRow), std::get<3>(*it));
-        lastRow = *it;
-    }
-    _lastRowtracker[key] = _buffer[key].back();
-
-    std::vector<typename TimeSeriesImputerEstimator::BaseType::TransformedType> results;
-    int count = 0;
-    for(std::size_t i=0; i< _buffer[key].size(); ++i)
-    {
-        if(no_nulls(std::get<3>(_buffer[key][i]))){
-            results.push_back(_buffer[key][i]);
-            count++;
+            nullStart = rowIndex + 1;
+            continue;
         }
-        else
-            break;
-    }
 
-    if(count > 0)
-        _buffer[key].erase(_buffer[key].begin(),_buffer[key].begin()+count);
+        if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(_colsToImputeDataTypes[colIndex]) == false) {
+            nullStart = rowIndex + 1;
+            continue;
+        }
 
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : results)
-        callback(std::move(addedRow));
-}
+        if(StrTraits::IsNull(rowData[colIndex])) {
+            // Nulls before the first value are never imputed
+            if(state.hasAnchor[colIndex] == false)
+                nullStart = rowIndex + 1;
 
-inline void TimeSeriesImputerEstimator::Transformer::ffill_or_median(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
+            continue;
+        }
 
-    typename TimeSeriesImputerEstimator::KeyType const & key = std::get<1>(input);
-    if ( _lastRowtracker.find(key) == _lastRowtracker.end() )
-            _lastRowtracker.insert(std::make_pair(key, std::tuple_cat(std::make_tuple(false), input)));
+        double_t const                                  value(Traits<std::double_t>::FromString(StrTraits::GetNullableValue(rowData[colIndex])));
 
-    typename TimeSeriesImputerEstimator::OutputRowType  & lastRow = _lastRowtracker[key];
-    std::vector<TimeSeriesImputerEstimator::BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
+        if(state.hasAnchor[colIndex]) {
+            double_t const                              anchorValue(state.anchorValues[colIndex]);
+            TimePointType const                         anchorTP(state.anchorTimes[colIndex]);
+            double_t const                              span(static_cast<double_t>((rowTP - anchorTP).count()));
 
-    for(auto &addedRow : addedRowsResultset) {
-        if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward)
-            impute(std::get<3>(lastRow) , std::get<3>(addedRow));
-        else {
-            std::map<KeyType,std::vector<double_t>>::const_iterator const   iterMedian(_medianValues.find(key));
-            typename TimeSeriesImputerEstimator::ColsToImputeType &         addedRowData(std::get<3>(addedRow));
+            while(nullStart < rowIndex) {
+                ImputedRow &                            pendingRow(state.pendingRows[static_cast<size_t>(nullStart - state.pendingBase)]);
+                double_t const                          weight(span > 0 ? static_cast<double_t>((pendingRow.timePoint - anchorTP).count()) / span : 1.0);
 
-            for(std::size_t addedRowColIndex = 0; addedRowColIndex < addedRowData.size(); ++addedRowColIndex) {
+                pendingRow.values[colIndex] = Traits<std::double_t>::ToString(anchorValue + (value - anchorValue) * weight);
+                ++nullStart;
+            }
+        }
 
-                if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(_colsToImputeDataTypes[addedRowColIndex]) == false)
-                    continue;
+        state.hasAnchor[colIndex] = true;
+        state.anchorValues[colIndex] = value;
+        state.anchorTimes[colIndex] = rowTP;
+        nullStart = rowIndex + 1;
+    }
 
-                if(StrTraits::IsNull(addedRowData[addedRowColIndex])) {
-                    if(iterMedian == _medianValues.end())
-                    {
-                        if(_supressError)
-                            continue;
-                        else
-                            throw std::runtime_error("Invalid key");
-                    }
+    state.pendingRows.emplace_back(std::move(row));
 
-					assert(addedRowColIndex < _colsToImputeDataTypes.size());
-                    assert(addedRowColIndex < iterMedian->second.size());
-                    addedRowData[addedRowColIndex] = Traits<std::double_t>::ToString(iterMedian->second[addedRowColIndex]);
-                }
-            }
+    // Emit the rows where every column has been resolved
+    std::uint64_t                                       end(state.pendingBase + state.pendingRows.size());
 
-        }
+    for(auto const &nullStart : state.nullStart) {
+        if(nullStart < end)
+            end = nullStart;
+    }
 
-        lastRow = addedRow;
+    while(state.pendingBase < end) {
+        emit(grain, std::move(state.pendingRows.front()), callback);
+        state.pendingRows.pop_front();
+        ++state.pendingBase;
     }
 
-    _lastRowtracker[key] = lastRow;
+    // Enforce the lookahead; rows are checked as they are added, so at most one
+    // row can exceed it.
+    if(state.pendingRows.size() > _maxLookahead) {
+        if(_lookaheadPolicy == TimeSeriesLookaheadPolicy::Error)
+            throw std::runtime_error("The maximum lookahead was exceeded.");
+
+        assert(_lookaheadPolicy == TimeSeriesLookaheadPolicy::EmitAsNull);
+
+        emit(grain, std::move(state.pendingRows.front()), callback);
+        state.pendingRows.pop_front();
+        ++state.pendingBase;
+
+        for(auto &nullStart : state.nullStart) {
+            if(nullStart < state.pendingBase)
+                nullStart = state.pendingBase;
+        }
+    }
+}
 
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : addedRowsResultset)
-        callback(std::move(addedRow));
+inline /*static*/ void TimeSeriesImputerEstimator::Transformer::emit(GrainState const &grain, ImputedRow row, typename ThisBaseType::CallbackFunction const &callback) {
+    callback(std::make_tuple(row.isAdded, row.timePoint, *grain.pGrain, std::move(row.values)));
 }
 
 } // namespace Components
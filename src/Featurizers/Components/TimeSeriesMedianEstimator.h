@@ -8,6 +8,9 @@
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 #include "../Components/PipelineExecutionEstimatorImpl.h"
+#include "GrainInterner.h"
+#include "GrainPartitioner.h"
+#include "QuantileSketch.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -50,8 +53,15 @@ public:
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         TimeSeriesMedianEstimator
-///  \brief         This class computes the median per grain.
-///                 .
+///  \brief         This class computes the median per grain and column.
+///                 Each grain/column pair is tracked by a `QuantileSketch`, so
+///                 medians are exact for grains with up to `sketchSize` values
+///                 and approximate (with bounded memory) for larger grains.
+///
+///                 When `numThreads` is greater than 1, each batch passed to
+///                 fit is partitioned by grain and the partitions are processed
+///                 in parallel. Rows of a grain are applied in the same order
+///                 either way, so the results don't depend on `numThreads`.
 ///
 class TimeSeriesMedianEstimator : public FitEstimator<std::tuple<std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> {
 public:
@@ -60,7 +70,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesMedianEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes);
+    TimeSeriesMedianEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, std::uint16_t sketchSize=QuantileSketch::DefaultK, std::uint32_t numThreads=1);
     ~TimeSeriesMedianEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesMedianEstimator);
@@ -83,12 +93,12 @@ private:
     // |
     // ----------------------------------------------------------------------
 	std::vector<TypeId> const               _colsToImputeDataTypes;
-    // _aggregateTracker is used to track sum in fit, while countTracker tracks count.
-    // However, in complete_training_impl, we divide values(sum) in _aggregateTracker
-    // by corresponding counts and after that it tracks median.
-    // Annotation is created using _aggregateTracker.
-    std::map<KeyType,std::vector<double_t>>  _aggregateTracker;
-    std::map<KeyType,std::vector<int64_t>>   _countTracker;
+    std::uint16_t const                     _sketchSize;
+    std::uint32_t const                     _numThreads;
+
+    // Indexed by grain id, then by column
+    GrainInterner                           _grainInterner;
+    std::vector<std::vector<QuantileSketch>>    _sketches;
 
     // ----------------------------------------------------------------------
     // |
@@ -99,6 +109,9 @@ private:
     FitResult fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) override;
 
     void complete_training_impl(void) override;
+
+    GrainInterner::IdType intern_grain(KeyType const &key, size_t cColumns);
+    void update_grain(std::vector<QuantileSketch> &sketches, ColsToImputeType const &colValues) const;
 };
 
 // ----------------------------------------------------------------------
@@ -125,9 +138,18 @@ inline TimeSeriesMedianAnnotation::TimeSeriesMedianAnnotation(TimeSeriesMedianAn
 // |  TimeSeriesMedianEstimator
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesMedianEstimator::TimeSeriesMedianEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes) :
+inline TimeSeriesMedianEstimator::TimeSeriesMedianEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes, std::uint16_t sketchSize, std::uint32_t numThreads) :
     BaseType("TimeSeriesMedianEstimator", std::move(pAllColumnAnnotations)),
-    _colsToImputeDataTypes(std::move(colsToImputeDataTypes)) {
+    _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
+    _sketchSize(
+        [&sketchSize](void) {
+            if(sketchSize < QuantileSketch::MinK)
+                throw std::invalid_argument("sketchSize");
+
+            return sketchSize;
+        }()
+    ),
+    _numThreads(numThreads) {
 }
 
 inline /*static*/ bool TimeSeriesMedianEstimator::DoesColTypeSupportMedian(TypeId typeId) {
@@ -142,47 +164,86 @@ inline bool TimeSeriesMedianEstimator::begin_training_impl(void) /*override*/ {
 }
 
 inline FitResult TimeSeriesMedianEstimator::fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) {
-    typename BaseType::InputType const * const          pEndBuffer(pBuffer + cBuffer);
+    if(_numThreads == 1) {
+        typename BaseType::InputType const * const          pEndBuffer(pBuffer + cBuffer);
 
-    while(pBuffer != pEndBuffer) {
-        std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType> const &        input(*pBuffer++);
-        KeyType const &                                                 key (std::get<1>(input));
-        ColsToImputeType const &                                        colValues (std::get<2>(input));
+        while(pBuffer != pEndBuffer) {
+            std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType> const &        input(*pBuffer++);
+            ColsToImputeType const &                                        colValues (std::get<2>(input));
 
-        if(_aggregateTracker.find(key) == _aggregateTracker.end()) {
-            _aggregateTracker.insert(std::make_pair(key, std::vector<double_t>(colValues.size(), 0.0)));
-            _countTracker.insert(std::make_pair(key, std::vector<int64_t>(colValues.size(), 0)));
+            update_grain(_sketches[intern_grain(std::get<1>(input), colValues.size())], colValues);
         }
 
-        for(std::size_t i=0; i< colValues.size(); ++i) {
-            if(Traits<nonstd::optional<std::string>>::IsNull(colValues[i]) || DoesColTypeSupportMedian(_colsToImputeDataTypes[i]) == false)
-                continue;
+        return FitResult::Continue;
+    }
 
-            _aggregateTracker[key][i] += Traits<std::double_t>::FromString(Traits<nonstd::optional<std::string>>::GetNullableValue(colValues[i]));
-            _countTracker[key][i] += 1;
+    // Grains are interned up front so that _sketches doesn't change while the
+    // partitions are being processed.
+    GrainPartitions const                   partitions(
+        PartitionByGrain(
+            cBuffer,
+            [this, pBuffer](size_t row) {
+                return intern_grain(std::get<1>(pBuffer[row]), std::get<2>(pBuffer[row]).size());
+            }
+        )
+    );
+
+    ParallelForEach(
+        partitions.size(),
+        _numThreads,
+        [this, pBuffer, &partitions](size_t partition) {
+            std::vector<QuantileSketch> &   sketches(_sketches[partitions.GrainIds[partition]]);
+
+            for(size_t offset = partitions.Offsets[partition]; offset < partitions.Offsets[partition + 1]; ++offset)
+                update_grain(sketches, std::get<2>(pBuffer[partitions.RowIndexes[offset]]));
         }
-    }
+    );
 
     return FitResult::Continue;
 }
 
 inline void TimeSeriesMedianEstimator::complete_training_impl(void) {
-    // Note that this class reuses _aggregateTracker to calculate median values before
-    // moving it to the annotation.
-    for(auto & kvp: _aggregateTracker) {
-        KeyType const & key = kvp.first;
-        for(std::size_t i=0; i< kvp.second.size(); ++i) {
-            auto count = _countTracker[key][i];
+    TimeSeriesMedianAnnotation::MedianMapType           medians;
+
+    for(GrainInterner::IdType grainId = 0; grainId < _sketches.size(); ++grainId) {
+        std::vector<QuantileSketch> &                   sketches(_sketches[grainId]);
+        std::vector<double_t>                           values(sketches.size(), 0.0);
+
+        for(std::size_t i=0; i< sketches.size(); ++i) {
             if(DoesColTypeSupportMedian(_colsToImputeDataTypes[i]) == false)
                 continue;
-            if(count == 0)
+            if(sketches[i].empty())
                 throw std::runtime_error("No valid value found for median computation.");
-            kvp.second[i] /= count;
+            values[i] = sketches[i].median();
         }
+
+        medians.emplace(_grainInterner.get(grainId), std::move(values));
+
+        // Release the grain's sketches as soon as its medians are known
+        std::vector<QuantileSketch>().swap(sketches);
     }
-    _countTracker.clear();
+    _grainInterner.clear();
+    _sketches.clear();
+
+    BaseType::add_annotation(std::make_shared<TimeSeriesMedianAnnotation>(std::move(medians)), 0);
+}
+
+inline GrainInterner::IdType TimeSeriesMedianEstimator::intern_grain(KeyType const &key, size_t cColumns) {
+    GrainInterner::IdType const             grainId(_grainInterner.intern(key));
+
+    if(grainId == _sketches.size())
+        _sketches.emplace_back(cColumns, QuantileSketch(_sketchSize));
 
-    BaseType::add_annotation(std::make_shared<TimeSeriesMedianAnnotation>(std::move(_aggregateTracker)), 0);
+    return grainId;
+}
+
+inline void TimeSeriesMedianEstimator::update_grain(std::vector<QuantileSketch> &sketches, ColsToImputeType const &colValues) const {
+    for(std::size_t i=0; i< colValues.size(); ++i) {
+        if(Traits<nonstd::optional<std::string>>::IsNull(colValues[i]) || DoesColTypeSupportMedian(_colsToImputeDataTypes[i]) == false)
+            continue;
+
+        sketches[i].update(Traits<std::double_t>::FromString(Traits<nonstd::optional<std::string>>::GetNullableValue(colValues[i])));
+    }
 }
 
 } // namespace Components
@@ -4,6 +4,7 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include "../../Archive.h"
 #include "../../Featurizer.h"
 
 namespace Microsoft {
@@ -38,6 +39,10 @@ namespace Components {
 ///
 ///                         <structure or value containing state data> complete_training(void);
 ///
+///                         [optional]
+///                         void save_training_state(Archive &ar) const;
+///                         void restore_training_state(Archive &ar);
+///
 template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
 class TrainingOnlyEstimatorImpl :
     public FitEstimator<typename EstimatorPolicyT::InputType>,
@@ -88,6 +93,28 @@ public:
 
     static AnnotationData const & get_annotation_data(Annotation const &annotation);
 
+    /// Saves the state accumulated by `fit` so that it can be restored into a
+    /// newly created Estimator that has begun training; only available when the
+    /// EstimatorPolicy can save and restore its training state.
+    // MSVC has problems when the declaration and definition are separated
+    template <typename PolicyT=EstimatorPolicyT>
+    auto save_training_state(Archive &ar) const -> decltype(std::declval<PolicyT const &>().save_training_state(ar)) {
+        Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(_cRemainingTrainingItems));
+        PolicyT::save_training_state(ar);
+    }
+
+    // MSVC has problems when the declaration and definition are separated
+    template <typename PolicyT=EstimatorPolicyT>
+    auto restore_training_state(Archive &ar) -> decltype(std::declval<PolicyT &>().restore_training_state(ar)) {
+        std::uint64_t const                 cRemainingTrainingItems(Traits<std::uint64_t>::deserialize(ar));
+
+        if(cRemainingTrainingItems > MaxNumTrainingItems)
+            throw std::runtime_error("Invalid remaining training items");
+
+        _cRemainingTrainingItems = static_cast<size_t>(cRemainingTrainingItems);
+        PolicyT::restore_training_state(ar);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
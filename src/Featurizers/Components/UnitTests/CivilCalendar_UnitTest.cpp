@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <limits>
+#include <vector>
+
+#include "../CivilCalendar.h"
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wold-style-cast"
+#   pragma clang diagnostic ignored "-Wshift-sign-overflow"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#elif (defined _MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable: 4244) // conversion from 'unsigned int' to 'unsigned char', possible loss of data
+#endif
+
+#include "../../../3rdParty/iso_week.h"
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#elif (defined _MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace NS = Microsoft::Featurizer;
+
+using NS::Featurizers::Components::CivilDate;
+
+// Calculates the values with the date library
+CivilDate Reference(std::int32_t days) {
+    date::sys_days const                    sysDays{ date::days(days) };
+    date::year_month_day const              ymd(sysDays);
+    iso_week::year_weeknum_weekday const    iso(sysDays);
+
+    int const                               year(static_cast<int>(ymd.year()));
+    unsigned const                          month(static_cast<unsigned>(ymd.month()));
+    date::year_month_day const              startOfYear(ymd.year(), date::month(1), date::day(1));
+    date::year_month_day const              startOfQuarter(ymd.year(), date::month((month - 1) / 3 * 3 + 1), date::day(1));
+
+    CivilDate                               result;
+
+    result.year = year;
+    result.month = static_cast<std::uint8_t>(month);
+    result.day = static_cast<std::uint8_t>(static_cast<unsigned>(ymd.day()));
+    result.dayOfWeek = static_cast<std::uint8_t>(static_cast<unsigned>(date::weekday(sysDays)));
+    result.dayOfYear = static_cast<std::uint16_t>((sysDays - date::sys_days(startOfYear)).count());
+    result.quarterOfYear = static_cast<std::uint8_t>((month + 2) / 3);
+    result.dayOfQuarter = static_cast<std::uint8_t>((sysDays - date::sys_days(startOfQuarter)).count() + 1);
+    result.weekIso = static_cast<std::uint8_t>(static_cast<unsigned>(iso.weeknum()));
+    result.yearIso = static_cast<int>(iso.year());
+
+    return result;
+}
+
+bool IsEqual(CivilDate const &a, CivilDate const &b) {
+    return a.year == b.year
+        && a.month == b.month
+        && a.day == b.day
+        && a.dayOfWeek == b.dayOfWeek
+        && a.dayOfYear == b.dayOfYear
+        && a.quarterOfYear == b.quarterOfYear
+        && a.dayOfQuarter == b.dayOfQuarter
+        && a.weekIso == b.weekIso
+        && a.yearIso == b.yearIso;
+}
+
+// Only called on mismatches, as there are millions of comparisons
+void Compare(CivilDate const &actual, CivilDate const &expected) {
+    REQUIRE(actual.year == expected.year);
+    REQUIRE(actual.month == expected.month);
+    REQUIRE(actual.day == expected.day);
+    REQUIRE(actual.dayOfWeek == expected.dayOfWeek);
+    REQUIRE(actual.dayOfYear == expected.dayOfYear);
+    REQUIRE(actual.quarterOfYear == expected.quarterOfYear);
+    REQUIRE(actual.dayOfQuarter == expected.dayOfQuarter);
+    REQUIRE(actual.weekIso == expected.weekIso);
+    REQUIRE(actual.yearIso == expected.yearIso);
+}
+
+TEST_CASE("Known dates") {
+    // 1970-01-01, Thursday
+    CivilDate const                         epoch(NS::Featurizers::Components::CivilFromDays(0));
+
+    CHECK(epoch.year == 1970);
+    CHECK(epoch.month == 1);
+    CHECK(epoch.day == 1);
+    CHECK(epoch.dayOfWeek == 4);
+    CHECK(epoch.dayOfYear == 0);
+    CHECK(epoch.weekIso == 1);
+    CHECK(epoch.yearIso == 1970);
+
+    // 1776-07-04, Thursday
+    CivilDate const                         independence(NS::Featurizers::Components::CivilFromDays(NS::Featurizers::Components::DaysFromCivil(1776, 7, 4)));
+
+    CHECK(independence.year == 1776);
+    CHECK(independence.month == 7);
+    CHECK(independence.day == 4);
+    CHECK(independence.dayOfWeek == 4);
+    CHECK(independence.quarterOfYear == 3);
+    CHECK(independence.dayOfQuarter == 4);
+
+    // 2021-01-01 is in the last ISO week of 2020
+    CivilDate const                         newYear(NS::Featurizers::Components::CivilFromDays(NS::Featurizers::Components::DaysFromCivil(2021, 1, 1)));
+
+    CHECK(newYear.weekIso == 53);
+    CHECK(newYear.yearIso == 2020);
+
+    CHECK_THROWS_WITH(NS::Featurizers::Components::DaysFromCivil(2020, 13, 1), "month");
+    CHECK_THROWS_WITH(NS::Featurizers::Components::DaysFromCivil(2020, 1, 0), "day");
+}
+
+TEST_CASE("Consistency with the date library") {
+    // -1000 through 3000
+    std::int32_t const                      first(NS::Featurizers::Components::DaysFromCivil(-1000, 1, 1));
+    std::int32_t const                      last(NS::Featurizers::Components::DaysFromCivil(3000, 12, 31));
+
+    for(std::int32_t days = first; days <= last; ++days) {
+        CivilDate const                     actual(NS::Featurizers::Components::CivilFromDays(days));
+        CivilDate const                     expected(Reference(days));
+
+        if(IsEqual(actual, expected) == false) {
+            INFO(days);
+            Compare(actual, expected);
+        }
+
+        if(NS::Featurizers::Components::DaysFromCivil(actual.year, actual.month, actual.day) != days)
+            REQUIRE(NS::Featurizers::Components::DaysFromCivil(actual.year, actual.month, actual.day) == days);
+    }
+}
+
+TEST_CASE("Batch") {
+    std::vector<std::int32_t>               days;
+
+    for(std::int32_t value = -200000; value <= 200000; value += 37)
+        days.push_back(value);
+
+    std::vector<std::int32_t>               years(days.size());
+    std::vector<std::uint8_t>               months(days.size());
+    std::vector<std::uint8_t>               daysOfMonth(days.size());
+    std::vector<std::uint8_t>               daysOfWeek(days.size());
+    std::vector<std::uint16_t>              daysOfYear(days.size());
+    std::vector<std::uint8_t>               quarters(days.size());
+    std::vector<std::uint8_t>               daysOfQuarter(days.size());
+    std::vector<std::uint8_t>               weeksIso(days.size());
+    std::vector<std::int32_t>               yearsIso(days.size());
+
+    NS::Featurizers::Components::CivilDateColumns const     columns{
+        years.data(),
+        months.data(),
+        daysOfMonth.data(),
+        daysOfWeek.data(),
+        daysOfYear.data(),
+        quarters.data(),
+        daysOfQuarter.data(),
+        weeksIso.data(),
+        yearsIso.data()
+    };
+
+    NS::Featurizers::Components::CivilFromDaysBatch(days.data(), days.size(), columns);
+
+    for(size_t i = 0; i < days.size(); ++i) {
+        CivilDate                           actual;
+
+        actual.year = years[i];
+        actual.month = months[i];
+        actual.day = daysOfMonth[i];
+        actual.dayOfWeek = daysOfWeek[i];
+        actual.dayOfYear = daysOfYear[i];
+        actual.quarterOfYear = quarters[i];
+        actual.dayOfQuarter = daysOfQuarter[i];
+        actual.weekIso = weeksIso[i];
+        actual.yearIso = yearsIso[i];
+
+        CivilDate const                     expected(NS::Featurizers::Components::CivilFromDays(days[i]));
+
+        if(IsEqual(actual, expected) == false) {
+            INFO(days[i]);
+            Compare(actual, expected);
+        }
+    }
+
+    NS::Featurizers::Components::CivilFromDaysBatch(nullptr, 0, NS::Featurizers::Components::CivilDateColumns());
+    CHECK_THROWS_WITH(NS::Featurizers::Components::CivilFromDaysBatch(days.data(), 1, NS::Featurizers::Components::CivilDateColumns()), "columns");
+}
+
+TEST_CASE("SplitTimePoint") {
+    std::int32_t                            days;
+    std::int32_t                            secondsOfDay;
+
+    NS::Featurizers::Components::SplitTimePoint(std::chrono::system_clock::from_time_t(86400 * 3 + 5), days, secondsOfDay);
+    CHECK(days == 3);
+    CHECK(secondsOfDay == 5);
+
+    NS::Featurizers::Components::SplitTimePoint(std::chrono::system_clock::from_time_t(-1), days, secondsOfDay);
+    CHECK(days == -1);
+    CHECK(secondsOfDay == 86399);
+
+    NS::Featurizers::Components::SplitTimePoint(std::chrono::system_clock::from_time_t(-86400), days, secondsOfDay);
+    CHECK(days == -1);
+    CHECK(secondsOfDay == 0);
+
+    // Fractions of a second before the epoch belong to the previous second
+    NS::Featurizers::Components::SplitTimePoint(std::chrono::system_clock::from_time_t(0) - std::chrono::milliseconds(1), days, secondsOfDay);
+    CHECK(days == -1);
+    CHECK(secondsOfDay == 86399);
+}
+
+TEST_CASE("SplitSeconds") {
+    std::int32_t                            days;
+    std::int32_t                            secondsOfDay;
+
+    NS::Featurizers::Components::SplitSeconds(86400 * 3 + 5, days, secondsOfDay);
+    CHECK(days == 3);
+    CHECK(secondsOfDay == 5);
+
+    NS::Featurizers::Components::SplitSeconds(-1, days, secondsOfDay);
+    CHECK(days == -1);
+    CHECK(secondsOfDay == 86399);
+
+    NS::Featurizers::Components::SplitSeconds(-86400, days, secondsOfDay);
+    CHECK(days == -1);
+    CHECK(secondsOfDay == 0);
+
+    NS::Featurizers::Components::SplitSeconds(-86401, days, secondsOfDay);
+    CHECK(days == -2);
+    CHECK(secondsOfDay == 86399);
+
+    // Range limits
+    std::int32_t const                      minDays(NS::Featurizers::Components::MinDays);
+    std::int32_t const                      maxDays(NS::Featurizers::Components::MaxDays);
+
+    NS::Featurizers::Components::SplitSeconds(static_cast<std::int64_t>(maxDays) * 86400 + 86399, days, secondsOfDay);
+    CHECK(days == maxDays);
+    CHECK(secondsOfDay == 86399);
+
+    NS::Featurizers::Components::SplitSeconds(static_cast<std::int64_t>(minDays) * 86400, days, secondsOfDay);
+    CHECK(days == minDays);
+    CHECK(secondsOfDay == 0);
+
+    CHECK_THROWS_WITH(NS::Featurizers::Components::SplitSeconds(static_cast<std::int64_t>(maxDays) * 86400 + 86400, days, secondsOfDay), "secondsSinceEpoch");
+    CHECK_THROWS_WITH(NS::Featurizers::Components::SplitSeconds(static_cast<std::int64_t>(minDays) * 86400 - 1, days, secondsOfDay), "secondsSinceEpoch");
+    CHECK_THROWS_WITH(NS::Featurizers::Components::SplitSeconds(std::numeric_limits<std::int64_t>::max(), days, secondsOfDay), "secondsSinceEpoch");
+    CHECK_THROWS_WITH(NS::Featurizers::Components::SplitSeconds(std::numeric_limits<std::int64_t>::min(), days, secondsOfDay), "secondsSinceEpoch");
+
+    // The calendar fields at the limits are valid
+    CHECK(NS::Featurizers::Components::CivilFromDays(maxDays).year > 5000000);
+    CHECK(NS::Featurizers::Components::CivilFromDays(minDays).year < -5000000);
+}
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../CompactStringIndexMap.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using CompactStringIndexMap                 = NS::Featurizers::Components::CompactStringIndexMap;
+using IndexMap                              = CompactStringIndexMap::IndexMap;
+
+TEST_CASE("Empty") {
+    CompactStringIndexMap const             map;
+
+    CHECK(map.empty());
+    CHECK(map.size() == 0);
+    CHECK(map.find("") == nullptr);
+    CHECK(map.find("one") == nullptr);
+    CHECK_THROWS_AS(map.at("one"), std::out_of_range);
+}
+
+TEST_CASE("Lookup") {
+    IndexMap const                          source{ {"one", 1u}, {"two", 2u}, {"three", 3u}, {"", 0u}, {"a longer string value", 10u} };
+    CompactStringIndexMap const             map(source);
+
+    CHECK(map.size() == source.size());
+
+    for(auto const &kvp : source) {
+        std::uint32_t const *               pValue(map.find(kvp.first));
+
+        REQUIRE(pValue != nullptr);
+        CHECK(*pValue == kvp.second);
+        CHECK(map.at(kvp.first) == kvp.second);
+    }
+
+    CHECK(map.find("four") == nullptr);
+    CHECK(map.find("on") == nullptr);
+    CHECK(map.find("one ") == nullptr);
+    CHECK(map.find("onetwo", 3) != nullptr);
+
+    CHECK(map.to_map() == source);
+}
+
+TEST_CASE("Many items") {
+    IndexMap                                source;
+
+    for(std::uint32_t i = 0; i < 5000; ++i)
+        source.emplace(std::to_string(i * 7), i);
+
+    CompactStringIndexMap const             map(source);
+
+    CHECK(map.size() == source.size());
+
+    for(auto const &kvp : source)
+        CHECK(map.at(kvp.first) == kvp.second);
+
+    CHECK(map.find("1") == nullptr);
+}
+
+TEST_CASE("Duplicate keys") {
+    CHECK_THROWS_WITH(CompactStringIndexMap::Create({ {"one", 1u}, {"two", 2u}, {"one", 3u} }), "Duplicate key");
+}
+
+TEST_CASE("Equality") {
+    CompactStringIndexMap const             map(IndexMap{ {"one", 1u}, {"two", 2u} });
+
+    CHECK(map == CompactStringIndexMap::Create({ {"two", 2u}, {"one", 1u} }));
+    CHECK(map != CompactStringIndexMap::Create({ {"one", 1u}, {"two", 3u} }));
+    CHECK(map != CompactStringIndexMap::Create({ {"one", 1u} }));
+    CHECK(map != CompactStringIndexMap::Create({ {"one", 1u}, {"three", 2u} }));
+}
+
+TEST_CASE("Copy and move") {
+    CompactStringIndexMap                   map(IndexMap{ {"one", 1u}, {"two", 2u} });
+    CompactStringIndexMap const             copied(map);
+    CompactStringIndexMap const             moved(std::move(map));
+
+    CHECK(copied.at("one") == 1u);
+    CHECK(moved.at("two") == 2u);
+    CHECK(copied == moved);
+}
+
+TEST_CASE("Serialization") {
+    CompactStringIndexMap const             map(IndexMap{ {"one", 1u}, {"two", 2u}, {"three", 3u} });
+    NS::Archive                             out;
+
+    NS::Traits<CompactStringIndexMap>::serialize(out, map);
+
+    NS::Archive::ByteArray const            buffer(out.commit());
+
+    // The layout is compatible with IndexMap
+    NS::Archive                             in1(buffer);
+
+    CHECK(NS::Traits<IndexMap>::deserialize(in1) == map.to_map());
+    CHECK(in1.AtEnd());
+
+    NS::Archive                             in2(buffer);
+
+    CHECK(NS::Traits<CompactStringIndexMap>::deserialize(in2) == map);
+    CHECK(in2.AtEnd());
+}
+
+TEST_CASE("Serialization errors") {
+    // The number of items exceeds what the archive can hold
+    NS::Archive                             out;
+
+    NS::Traits<std::uint32_t>::serialize(out, std::numeric_limits<std::uint32_t>::max());
+    NS::Traits<std::string>::serialize(out, std::string("one"));
+    NS::Traits<std::uint32_t>::serialize(out, 1u);
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(NS::Traits<CompactStringIndexMap>::deserialize(in), "Invalid number of items");
+}
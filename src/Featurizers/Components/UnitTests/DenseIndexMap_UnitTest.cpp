@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include "../DenseIndexMap.h"
+
+namespace NS = Microsoft::Featurizer;
+
+template <typename T>
+using IndexMap                              = std::unordered_map<T, std::uint32_t>;
+
+TEST_CASE("Non-integral") {
+    NS::Featurizers::Components::DenseIndexMap<std::string> const   map(IndexMap<std::string>{ {"one", 0u} }, 0, 0);
+
+    CHECK(map.is_enabled() == false);
+}
+
+TEST_CASE("Empty") {
+    NS::Featurizers::Components::DenseIndexMap<int> const   map(IndexMap<int>(), 0, 0);
+
+    CHECK(map.is_enabled() == false);
+}
+
+TEST_CASE("Lookup") {
+    NS::Featurizers::Components::DenseIndexMap<int> const   map(IndexMap<int>{ {-2, 0u}, {3, 1u}, {10, 2u} }, 1, 0);
+
+    REQUIRE(map.is_enabled());
+
+    CHECK(map.lookup(-2) == 1u);
+    CHECK(map.lookup(3) == 2u);
+    CHECK(map.lookup(10) == 3u);
+    CHECK(map.lookup(0) == 0u);
+    CHECK(map.lookup(-3) == 0u);
+    CHECK(map.lookup(11) == 0u);
+    CHECK(map.lookup(std::numeric_limits<int>::min()) == 0u);
+    CHECK(map.lookup(std::numeric_limits<int>::max()) == 0u);
+
+    std::vector<int> const                  input({10, -2, 4, 3, 1000});
+    std::vector<std::uint64_t>              output(input.size());
+
+    map.lookup(input.data(), input.size(), output.data());
+    CHECK(output == std::vector<std::uint64_t>({3, 1, 0, 2, 0}));
+}
+
+TEST_CASE("Full range of a small type") {
+    IndexMap<std::int8_t>                   source;
+
+    for(int i = -128; i <= 127; ++i)
+        source.emplace(static_cast<std::int8_t>(i), static_cast<std::uint32_t>(i + 128));
+
+    NS::Featurizers::Components::DenseIndexMap<std::int8_t> const   map(source, 0, 1000);
+
+    REQUIRE(map.is_enabled());
+
+    for(int i = -128; i <= 127; ++i)
+        CHECK(map.lookup(static_cast<std::int8_t>(i)) == static_cast<std::uint32_t>(i + 128));
+}
+
+TEST_CASE("Sparse") {
+    CHECK(NS::Featurizers::Components::DenseIndexMap<std::int64_t>(IndexMap<std::int64_t>{ {0, 0u}, {4095, 1u} }, 0, 0).is_enabled());
+    CHECK(NS::Featurizers::Components::DenseIndexMap<std::int64_t>(IndexMap<std::int64_t>{ {0, 0u}, {4096, 1u} }, 0, 0).is_enabled() == false);
+    CHECK(NS::Featurizers::Components::DenseIndexMap<std::int64_t>(IndexMap<std::int64_t>{ {std::numeric_limits<std::int64_t>::min(), 0u}, {std::numeric_limits<std::int64_t>::max(), 1u} }, 0, 0).is_enabled() == false);
+    CHECK(NS::Featurizers::Components::DenseIndexMap<std::uint64_t>(IndexMap<std::uint64_t>{ {0, 0u}, {std::numeric_limits<std::uint64_t>::max(), 1u} }, 0, 0).is_enabled() == false);
+}
@@ -6,7 +6,9 @@
 #include "catch.hpp"
 
 #include "../GrainEstimatorImpl.h"
+#include "../HistogramEstimator.h"
 #include "../InferenceOnlyFeaturizerImpl.h"
+#include "../MinMaxEstimator.h"
 #include "../TrainingOnlyEstimatorImpl.h"
 
 #include "../../TestHelpers.h"
@@ -81,7 +83,9 @@ using SumTrainingOnlyEstimator              = Components::TrainingOnlyEstimatorI
 /////////////////////////////////////////////////////////////////////////
 ///  \class         DeltaTransformer
 ///  \brief         Transformer that adds a delta (which is considered to
-///                 be the Transformer's state) to each incoming value.
+///                 be the Transformer's state) to each incoming value. When
+///                 flushed, the delta is produced if any values were executed
+///                 since the last flush.
 ///
 class DeltaTransformer : public NS::StandardTransformer<std::uint64_t, std::uint64_t> {
 public:
@@ -98,7 +102,8 @@ public:
     // |
     // ----------------------------------------------------------------------
     DeltaTransformer(std::uint64_t delta) :
-        _delta(std::move(delta)) {
+        _delta(std::move(delta)),
+        _hasPendingValues(false) {
     }
 
     DeltaTransformer(NS::Archive &ar) :
@@ -120,6 +125,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     std::uint64_t const                     _delta;
+    bool                                    _hasPendingValues;
 
     // ----------------------------------------------------------------------
     // |
@@ -127,8 +133,17 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        _hasPendingValues = true;
         callback(input + _delta);
     }
+
+    void flush_impl(typename BaseType::CallbackFunction const &callback) override {
+        if(_hasPendingValues == false)
+            return;
+
+        _hasPendingValues = false;
+        callback(_delta);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -160,6 +175,14 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(DeltaEstimator);
 
+    void save_training_state(NS::Archive &ar) const {
+        NS::Traits<std::uint64_t>::serialize(ar, _runningTotal);
+    }
+
+    void restore_training_state(NS::Archive &ar) {
+        _runningTotal = NS::Traits<std::uint64_t>::deserialize(ar);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -594,6 +617,53 @@ TEST_CASE("Estimator - limited individual training items") {
     }
 }
 
+TEST_CASE("Estimator - batched fitting") {
+    // ----------------------------------------------------------------------
+    using ThisSumTrainingOnlyEstimator      = SumTrainingOnlyEstimator<2>;
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, ThisSumTrainingOnlyEstimator>;
+    using GrainEstimatorAnnotation          = Components::GrainEstimatorAnnotation<std::string>;
+    // ----------------------------------------------------------------------
+
+    // Each grain's estimator only sees its first 2 items, so the items must be
+    // provided to it in order whether the items of the grains are interleaved
+    // or already grouped by grain.
+    std::vector<typename Estimator::InputType>          interleavedInputs;
+    std::vector<typename Estimator::InputType>          groupedInputs;
+
+    for(std::uint32_t i = 0; i < 10; ++i) {
+        for(std::uint32_t grain = 0; grain < 20; ++grain)
+            interleavedInputs.emplace_back(std::to_string(grain), (grain + 1) * (i + 1));
+    }
+
+    for(std::uint32_t grain = 0; grain < 20; ++grain) {
+        for(std::uint32_t i = 0; i < 10; ++i)
+            groupedInputs.emplace_back(std::to_string(grain), (grain + 1) * (i + 1));
+    }
+
+    for(std::vector<typename Estimator::InputType> const *pInputs : {&interleavedInputs, &groupedInputs}) {
+        for(std::uint32_t numThreads : {1u, 4u, 0u}) {
+            Estimator                       estimator(
+                "Test",
+                NS::CreateTestAnnotationMapsPtr(1),
+                [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                    return ThisSumTrainingOnlyEstimator(std::move(pAllColumnAnnotationsParam), 0);
+                },
+                Components::UnseenGrainPolicy::Error,
+                numThreads
+            );
+
+            GrainEstimatorAnnotation::AnnotationMap     annotations(Test(estimator, *pInputs));
+
+            REQUIRE(annotations.size() == 20);
+
+            for(std::uint32_t grain = 0; grain < 20; ++grain) {
+                REQUIRE(annotations.find(std::to_string(grain)) != annotations.end());
+                CHECK(ThisSumTrainingOnlyEstimator::get_annotation_data(*annotations.find(std::to_string(grain))->second).Value == (grain + 1) * 3);
+            }
+        }
+    }
+}
+
 template <typename TransformerT>
 void Execute(TransformerT &transformer, std::string const &grain, std::uint64_t const &input, std::uint64_t expected) {
     transformer.execute(
@@ -709,14 +779,386 @@ TEST_CASE("Transformer") {
     }
 }
 
+TEST_CASE("Transformer - unseen grains") {
+    // ----------------------------------------------------------------------
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
+    using GrainTransformer                  = Components::GrainTransformer<std::string, DeltaEstimator>;
+    // ----------------------------------------------------------------------
+
+    // The items are provided both interleaved and grouped by grain
+    for(bool isGrouped : {false, true}) {
+        for(Components::UnseenGrainPolicy policy : {Components::UnseenGrainPolicy::UseDefault, Components::UnseenGrainPolicy::CloneDefault}) {
+            NS::AnnotationMapsPtr               pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+            Estimator                           estimator(
+                "Test",
+                pAllColumnAnnotations,
+                [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                    return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+                },
+                policy
+            );
+
+            Test(
+                estimator,
+                NS::TestHelpers::make_vector<typename Estimator::InputType>(
+                    std::make_tuple("one", 10),
+                    std::make_tuple(isGrouped ? "one" : "two", isGrouped ? 20 : 100),
+                    std::make_tuple("two", 200),
+                    std::make_tuple(isGrouped ? "two" : "one", isGrouped ? 100 : 20)
+                ),
+                false
+            );
+
+            typename Estimator::TransformerUniquePtr const  pTransformer(estimator.create_transformer());
+
+            NS::Archive                         trainedArchive;
+
+            pTransformer->save(trainedArchive);
+
+            Execute(*pTransformer, "one", 1, 31);
+            Execute(*pTransformer, "two", 1, 301);
+
+            // The default transformer was trained on the items of all grains
+            Execute(*pTransformer, "A New Grain!!", 1, 331);
+            Execute(*pTransformer, "Another New Grain!!", 2, 332);
+            Execute(*pTransformer, "A New Grain!!", 3, 333);
+
+            // Archive; transformers cloned for unseen grains aren't saved
+            NS::Archive                         outArchive;
+
+            pTransformer->save(outArchive);
+
+            NS::Archive::ByteArray const        data(outArchive.commit());
+
+            CHECK(data == trainedArchive.commit());
+
+            NS::Archive                         inArchive(data);
+            GrainTransformer                    otherTransformer(inArchive);
+
+            Execute(otherTransformer, "one", 1, 31);
+            Execute(otherTransformer, "two", 1, 301);
+            Execute(otherTransformer, "Yet Another New Grain!!", 1, 331);
+            Execute(otherTransformer, "Yet Another New Grain!!", 2, 332);
+            Execute(otherTransformer, "A New Grain!!", 3, 333);
+
+            CHECK(otherTransformer.num_resident_grains() == (policy == Components::UnseenGrainPolicy::CloneDefault ? 4 : 2));
+
+            NS::Archive                         otherArchive;
+
+            otherTransformer.save(otherArchive);
+            CHECK(otherArchive.commit() == data);
+        }
+    }
+}
+
+TEST_CASE("Transformer - flush with unseen grains") {
+    // ----------------------------------------------------------------------
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
+    using FlushOutput                       = std::vector<std::tuple<std::string, std::uint64_t>>;
+    // ----------------------------------------------------------------------
+
+    for(Components::UnseenGrainPolicy policy : {Components::UnseenGrainPolicy::UseDefault, Components::UnseenGrainPolicy::CloneDefault}) {
+        NS::AnnotationMapsPtr               pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+        Estimator                           estimator(
+            "Test",
+            pAllColumnAnnotations,
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+            },
+            policy
+        );
+
+        Test(
+            estimator,
+            NS::TestHelpers::make_vector<typename Estimator::InputType>(
+                std::make_tuple("one", 10),
+                std::make_tuple("two", 100)
+            ),
+            false
+        );
+
+        typename Estimator::TransformerUniquePtr const  pTransformer(estimator.create_transformer());
+
+        Execute(*pTransformer, "one", 1, 11);
+        Execute(*pTransformer, "new", 1, 111);
+        Execute(*pTransformer, "", 1, 111);
+
+        FlushOutput                         output;
+
+        pTransformer->flush(
+            [&output](std::tuple<std::string, std::uint64_t> value) {
+                output.emplace_back(std::move(value));
+            }
+        );
+
+        if(policy == Components::UnseenGrainPolicy::UseDefault) {
+            // The shared default transformer's output can't be attributed to a grain
+            CHECK(output == FlushOutput{std::make_tuple("one", 10)});
+        }
+        else {
+            // Each unseen grain has its own transformer
+            CHECK(output == FlushOutput{std::make_tuple("", 110), std::make_tuple("new", 110), std::make_tuple("one", 10)});
+        }
+
+        // The default transformer's state was reset by the flush
+        output.clear();
+
+        pTransformer->flush(
+            [&output](std::tuple<std::string, std::uint64_t> value) {
+                output.emplace_back(std::move(value));
+            }
+        );
+
+        CHECK(output.empty());
+    }
+}
+
+TEST_CASE("Transformer - spilled estimators") {
+    // ----------------------------------------------------------------------
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
+    // ----------------------------------------------------------------------
+
+    for(size_t maxResidentEstimators : {1, 3, 100}) {
+        Estimator                           estimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+            },
+            Components::UnseenGrainPolicy::Error,
+            1,
+            maxResidentEstimators
+        );
+
+        estimator.begin_training();
+
+        // Each buffer contains a couple of grains, so most grains are spilled
+        // and restored several times.
+        for(std::uint64_t i = 0; i < 10; ++i) {
+            for(std::uint64_t grain = 0; grain < 10; grain += 2) {
+                std::vector<typename Estimator::InputType> const            inputs{
+                    std::make_tuple(std::to_string(grain), i),
+                    std::make_tuple(std::to_string(grain + 1), i * 10)
+                };
+
+                estimator.fit(inputs.data(), inputs.size());
+            }
+        }
+
+        estimator.complete_training();
+
+        typename Estimator::TransformerUniquePtr const  pTransformer(estimator.create_transformer());
+
+        for(std::uint64_t grain = 0; grain < 10; ++grain)
+            Execute(*pTransformer, std::to_string(grain), 1, grain % 2 ? 451 : 46);
+    }
+}
+
+TEST_CASE("Estimator - spilled training-only estimators") {
+    // ----------------------------------------------------------------------
+    using MinMaxEstimator                   = Components::MinMaxEstimator<std::int32_t, 3>;
+    using MinMaxGrainEstimator              = Components::GrainEstimatorImpl<std::string, MinMaxEstimator>;
+    using HistogramEstimator                = Components::HistogramEstimator<std::int32_t>;
+    using HistogramGrainEstimator           = Components::GrainEstimatorImpl<std::string, HistogramEstimator>;
+    using Histogram                         = typename Components::HistogramAnnotationData<std::int32_t>::Histogram;
+    // ----------------------------------------------------------------------
+
+    auto const                              fitFunc(
+        [](NS::FitEstimator<std::tuple<std::string, std::int32_t>> &estimator) {
+            estimator.begin_training();
+
+            // Every buffer contains a single grain, so the other grains are spilled
+            for(std::int32_t i = 0; i < 5; ++i) {
+                for(std::string const &grain : {"a", "b", "c"}) {
+                    std::tuple<std::string, std::int32_t> const                 input(grain, grain == "b" ? -i : i);
+
+                    estimator.fit(&input, 1);
+                }
+            }
+
+            estimator.complete_training();
+        }
+    );
+
+    SECTION("MinMaxEstimator") {
+        MinMaxGrainEstimator                estimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return MinMaxEstimator(std::move(pAllColumnAnnotationsParam), 0);
+            },
+            Components::UnseenGrainPolicy::Error,
+            1,
+            1
+        );
+
+        fitFunc(estimator);
+
+        NS::AnnotationMap const &           annotations(estimator.get_column_annotations()[0]);
+        auto const &                        grainAnnotations(static_cast<Components::GrainEstimatorAnnotation<std::string> const &>(*annotations.at(estimator.Name)[0]).Annotations);
+
+        // The number of items remaining for each Estimator survives the spill
+        CHECK(MinMaxEstimator::get_annotation_data(*grainAnnotations.at("a")).Max == 2);
+        CHECK(MinMaxEstimator::get_annotation_data(*grainAnnotations.at("b")).Min == -2);
+        CHECK(MinMaxEstimator::get_annotation_data(*grainAnnotations.at("c")).Min == 0);
+    }
+
+    SECTION("HistogramEstimator") {
+        HistogramGrainEstimator             estimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return HistogramEstimator(std::move(pAllColumnAnnotationsParam), 0);
+            },
+            Components::UnseenGrainPolicy::Error,
+            1,
+            2
+        );
+
+        fitFunc(estimator);
+
+        NS::AnnotationMap const &           annotations(estimator.get_column_annotations()[0]);
+        auto const &                        grainAnnotations(static_cast<Components::GrainEstimatorAnnotation<std::string> const &>(*annotations.at(estimator.Name)[0]).Annotations);
+
+        CHECK(HistogramEstimator::get_annotation_data(*grainAnnotations.at("a")).Value == Histogram{{0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}});
+        CHECK(HistogramEstimator::get_annotation_data(*grainAnnotations.at("b")).Value == Histogram{{0, 1}, {-1, 1}, {-2, 1}, {-3, 1}, {-4, 1}});
+    }
+}
+
+TEST_CASE("GrainTransformer - lazy deserialization") {
+    // ----------------------------------------------------------------------
+    using GrainTransformer                  = Components::GrainTransformer<std::string, DeltaEstimator>;
+    // ----------------------------------------------------------------------
+
+    NS::Archive::ByteArray const            data(
+        [](void) {
+            typename GrainTransformer::TransformerMap                       transformers;
+
+            for(std::uint64_t grain = 0; grain < 100; ++grain)
+                transformers.emplace(std::to_string(grain), typename GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(grain * 10)));
+
+            NS::Archive                     archive;
+
+            GrainTransformer(std::move(transformers)).save(archive);
+            return archive.commit();
+        }()
+    );
+
+    SECTION("Copied buffer") {
+        NS::Archive                         inArchive(data);
+        GrainTransformer                    transformer(inArchive);
+
+        CHECK(transformer.num_resident_grains() == 0);
+
+        Execute(transformer, "42", 1, 421);
+        Execute(transformer, "7", 2, 72);
+        Execute(transformer, "42", 3, 423);
+
+        CHECK(transformer.num_resident_grains() == 2);
+
+        CHECK_THROWS_WITH(
+            transformer.execute(
+                std::make_tuple("A New Grain!!", 100),
+                [](std::tuple<std::string, std::uint64_t>) {}
+            ),
+            "Grain not found"
+        );
+
+        // Saving a partially materialized transformer produces the original archive
+        NS::Archive                         outArchive;
+
+        transformer.save(outArchive);
+        CHECK(outArchive.commit() == data);
+    }
+
+    SECTION("Buffer owner") {
+        std::shared_ptr<NS::Archive::ByteArray>         pBuffer(std::make_shared<NS::Archive::ByteArray>(data));
+        NS::Archive                                     inArchive(pBuffer->data(), pBuffer->size());
+        GrainTransformer                                transformer(inArchive, pBuffer);
+
+        // The transformer keeps the buffer alive
+        pBuffer.reset();
+
+        Execute(transformer, "0", 1, 1);
+        Execute(transformer, "99", 1, 991);
+        CHECK(transformer.num_resident_grains() == 2);
+    }
+
+    SECTION("Max resident grains") {
+        NS::Archive                         inArchive(data);
+        GrainTransformer                    transformer(inArchive, std::shared_ptr<void const>(), 2);
+
+        Execute(transformer, "1", 1, 11);
+        Execute(transformer, "2", 1, 21);
+        Execute(transformer, "1", 1, 11);
+        Execute(transformer, "3", 1, 31);
+
+        // "2" was the least recently used
+        CHECK(transformer.num_resident_grains() == 2);
+
+        Execute(transformer, "2", 1, 21);
+        Execute(transformer, "3", 1, 31);
+        CHECK(transformer.num_resident_grains() == 2);
+
+        NS::Archive                         outArchive;
+
+        transformer.save(outArchive);
+        CHECK(outArchive.commit() == data);
+    }
+}
+
+/// Creates a GrainTransformer<int, DeltaEstimator> archive with the provided
+/// (grain, delta) records, in the order provided.
+NS::Archive::ByteArray CreateIndexedArchive(std::vector<std::tuple<int, std::uint64_t>> const &records) {
+    NS::Archive                             offsetsArchive;
+    NS::Archive::ByteArray                  recordsBuffer;
+
+    for(auto const &record : records) {
+        NS::Archive                         recordArchive;
+
+        NS::Traits<int>::serialize(recordArchive, std::get<0>(record));
+        DeltaTransformer(std::get<1>(record)).save(recordArchive);
+
+        NS::Archive::ByteArray const        recordBuffer(recordArchive.commit());
+
+        NS::Traits<std::uint64_t>::serialize(offsetsArchive, recordsBuffer.size());
+        recordsBuffer.insert(recordsBuffer.end(), recordBuffer.begin(), recordBuffer.end());
+    }
+
+    NS::Archive::ByteArray const            offsets(offsetsArchive.commit());
+    NS::Archive                             outArchive;
+
+    NS::Traits<std::uint8_t>::serialize(outArchive, static_cast<std::uint8_t>(Components::UnseenGrainPolicy::Error));
+    NS::Traits<std::uint64_t>::serialize(outArchive, records.size());
+    outArchive.serialize(offsets.data(), offsets.size());
+    NS::Traits<std::uint64_t>::serialize(outArchive, recordsBuffer.size());
+    outArchive.serialize(recordsBuffer.data(), recordsBuffer.size());
+
+    return outArchive.commit();
+}
+
 TEST_CASE("GrainTransformer - deserialization errors") {
     // ----------------------------------------------------------------------
     using GrainTransformer                  = Components::GrainTransformer<int, DeltaEstimator>;
     // ----------------------------------------------------------------------
 
+    SECTION("Invalid unseen grain policy") {
+        NS::Archive                         outArchive;
+
+        NS::Traits<std::uint8_t>::serialize(outArchive, 0);
+
+        NS::Archive                         inArchive(outArchive.commit());
+
+        CHECK_THROWS_WITH(
+            GrainTransformer(inArchive),
+            "Invalid unseen grain policy"
+        );
+    }
+
     SECTION("Invalid number of items") {
         NS::Archive                         outArchive;
 
+        NS::Traits<std::uint8_t>::serialize(outArchive, static_cast<std::uint8_t>(Components::UnseenGrainPolicy::Error));
         NS::Traits<std::uint64_t>::serialize(outArchive, 0);
 
         NS::Archive                         inArchive(outArchive.commit());
@@ -727,25 +1169,54 @@ TEST_CASE("GrainTransformer - deserialization errors") {
         );
     }
 
-    SECTION("Duplicate grain") {
-        NS::Archive                         outArchive;
+    SECTION("Invalid offsets") {
+        NS::Archive                         recordsArchive;
 
-        NS::Traits<std::uint64_t>::serialize(outArchive, 3);
+        NS::Traits<int>::serialize(recordsArchive, 1);
+        DeltaTransformer(10).save(recordsArchive);
 
-        NS::Traits<int>::serialize(outArchive, 1);
-        DeltaTransformer(10).save(outArchive);
+        NS::Traits<int>::serialize(recordsArchive, 2);
+        DeltaTransformer(20).save(recordsArchive);
 
-        NS::Traits<int>::serialize(outArchive, 2);
-        DeltaTransformer(20).save(outArchive);
+        NS::Archive::ByteArray const        records(recordsArchive.commit());
+        NS::Archive                         outArchive;
 
-        NS::Traits<int>::serialize(outArchive, 1);
-        DeltaTransformer(30).save(outArchive);
+        NS::Traits<std::uint8_t>::serialize(outArchive, static_cast<std::uint8_t>(Components::UnseenGrainPolicy::Error));
+        NS::Traits<std::uint64_t>::serialize(outArchive, 2);
+        NS::Traits<std::uint64_t>::serialize(outArchive, records.size() / 2);
+        NS::Traits<std::uint64_t>::serialize(outArchive, 0);
+        NS::Traits<std::uint64_t>::serialize(outArchive, records.size());
+        outArchive.serialize(records.data(), records.size());
 
         NS::Archive                         inArchive(outArchive.commit());
 
         CHECK_THROWS_WITH(
             GrainTransformer(inArchive),
-            "Invalid insertion"
+            "Invalid offsets"
+        );
+    }
+
+    SECTION("Sorted grains") {
+        NS::Archive                         inArchive(CreateIndexedArchive({std::make_tuple(1, 10), std::make_tuple(2, 20), std::make_tuple(3, 30)}));
+
+        CHECK_NOTHROW(GrainTransformer(inArchive));
+    }
+
+    SECTION("Duplicate grain") {
+        NS::Archive                         inArchive(CreateIndexedArchive({std::make_tuple(1, 10), std::make_tuple(2, 20), std::make_tuple(2, 30)}));
+
+        CHECK_THROWS_WITH(
+            GrainTransformer(inArchive),
+            "Invalid grain order"
+        );
+    }
+
+    SECTION("Unsorted grains") {
+        NS::Archive                         inArchive(CreateIndexedArchive({std::make_tuple(1, 10), std::make_tuple(3, 20), std::make_tuple(2, 30)}));
+
+        CHECK_THROWS_WITH(
+            GrainTransformer(inArchive),
+            "Invalid grain order"
         );
     }
 }
@@ -770,6 +1241,30 @@ TEST_CASE("GrainTransformer - construct errors") {
         GrainTransformer(typename GrainTransformer::TransformerMap()),
         "transformers"
     );
+
+    auto const                              createTransformers(
+        [](void) {
+            typename GrainTransformer::TransformerMap                       transformers;
+
+            transformers.emplace(1, typename GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(10)));
+            return transformers;
+        }
+    );
+
+    CHECK_THROWS_WITH(
+        GrainTransformer(createTransformers(), typename GrainTransformer::GrainTransformerTypeUniquePtr(), static_cast<Components::UnseenGrainPolicy>(0)),
+        "unseenGrainPolicy"
+    );
+
+    CHECK_THROWS_WITH(
+        GrainTransformer(createTransformers(), typename GrainTransformer::GrainTransformerTypeUniquePtr(), Components::UnseenGrainPolicy::UseDefault),
+        "pDefaultTransformer"
+    );
+
+    CHECK_THROWS_WITH(
+        GrainTransformer(createTransformers(), typename GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(10)), Components::UnseenGrainPolicy::Error),
+        "pDefaultTransformer"
+    );
 }
 
 TEST_CASE("GrainEstimatorImpl - construct errors") {
@@ -781,4 +1276,46 @@ TEST_CASE("GrainEstimatorImpl - construct errors") {
         GrainEstimator("Test", NS::CreateTestAnnotationMapsPtr(1), typename GrainEstimator::CreateEstimatorFunc()),
         "createFunc"
     );
+
+    CHECK_THROWS_WITH(
+        GrainEstimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+            },
+            Components::UnseenGrainPolicy::NumValues
+        ),
+        "unseenGrainPolicy"
+    );
+
+    // Estimators that don't create transformers don't have a default to fall back on
+    using SumGrainEstimator                 = Components::GrainEstimatorImpl<std::string, SumTrainingOnlyEstimator<>>;
+
+    // Estimators that can't save their training state can't be spilled
+    CHECK_THROWS_WITH(
+        SumGrainEstimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return SumTrainingOnlyEstimator<>(std::move(pAllColumnAnnotationsParam), 0);
+            },
+            Components::UnseenGrainPolicy::Error,
+            1,
+            10
+        ),
+        "maxResidentEstimators"
+    );
+
+    CHECK_THROWS_WITH(
+        SumGrainEstimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return SumTrainingOnlyEstimator<>(std::move(pAllColumnAnnotationsParam), 0);
+            },
+            Components::UnseenGrainPolicy::UseDefault
+        ),
+        "unseenGrainPolicy"
+    );
 }
@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../GrainInterner.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+using GrainType                             = Components::GrainInterner::GrainType;
+using IdType                                = Components::GrainInterner::IdType;
+
+TEST_CASE("Intern") {
+    Components::GrainInterner               interner;
+
+    CHECK(interner.size() == 0);
+    CHECK(interner.find(GrainType{"a"}) == static_cast<IdType>(Components::GrainInterner::InvalidId));
+
+    CHECK(interner.intern(GrainType{"b", "1"}) == 0);
+    CHECK(interner.intern(GrainType{"a"}) == 1);
+    CHECK(interner.intern(GrainType{"b", "1"}) == 0);
+    CHECK(interner.intern(GrainType{"b", "2"}) == 2);
+    CHECK(interner.intern(GrainType{"b1"}) == 3);
+    CHECK(interner.intern(GrainType{}) == 4);
+
+    CHECK(interner.size() == 5);
+    CHECK(interner.find(GrainType{"a"}) == 1);
+    CHECK(interner.find(GrainType{"b"}) == static_cast<IdType>(Components::GrainInterner::InvalidId));
+
+    CHECK(interner.get(0) == GrainType{"b", "1"});
+    CHECK(interner.get(4) == GrainType{});
+    CHECK_THROWS_WITH(interner.get(5), "id");
+
+    CHECK(interner.sorted_ids() == std::vector<IdType>{4, 1, 0, 2, 3});
+
+    interner.clear();
+
+    CHECK(interner.size() == 0);
+    CHECK(interner.intern(GrainType{"a"}) == 0);
+}
+
+TEST_CASE("Many grains") {
+    Components::GrainInterner               interner;
+
+    for(IdType id = 0; id < 10000; ++id)
+        CHECK(interner.intern(GrainType{"grain", std::to_string(id)}) == id);
+
+    // Moving the interner must not invalidate the grains
+    Components::GrainInterner               other(std::move(interner));
+
+    for(IdType id = 0; id < 10000; ++id) {
+        CHECK(other.get(id) == GrainType{"grain", std::to_string(id)});
+        CHECK(other.find(GrainType{"grain", std::to_string(id)}) == id);
+    }
+}
+
+TEST_CASE("Hash") {
+    Components::GrainHash const             hasher;
+
+    CHECK(hasher(GrainType{"a", "b"}) == hasher(GrainType{"a", "b"}));
+    CHECK(hasher(GrainType{"a", "b"}) != hasher(GrainType{"b", "a"}));
+    CHECK(hasher(GrainType{"ab"}) != hasher(GrainType{"a", "b"}));
+}
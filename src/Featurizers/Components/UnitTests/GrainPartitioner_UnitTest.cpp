@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../GrainPartitioner.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+using IdType                                = Components::GrainInterner::IdType;
+
+TEST_CASE("PartitionByGrain") {
+    std::vector<IdType> const               grainIds{5, 2, 5, 7, 2, 5};
+    Components::GrainPartitions const       partitions(
+        Components::PartitionByGrain(
+            grainIds.size(),
+            [&grainIds](size_t row) {
+                return grainIds[row];
+            }
+        )
+    );
+
+    CHECK(partitions.size() == 3);
+    CHECK(partitions.GrainIds == std::vector<IdType>{5, 2, 7});
+    CHECK(partitions.Offsets == std::vector<size_t>{0, 3, 5, 6});
+    CHECK(partitions.RowIndexes == std::vector<size_t>{0, 2, 5, 1, 4, 3});
+}
+
+TEST_CASE("PartitionByGrain - empty") {
+    Components::GrainPartitions const       partitions(
+        Components::PartitionByGrain(
+            0,
+            [](size_t) {
+                return static_cast<IdType>(0);
+            }
+        )
+    );
+
+    CHECK(partitions.size() == 0);
+    CHECK(partitions.Offsets == std::vector<size_t>{0});
+    CHECK(partitions.RowIndexes.empty());
+}
+
+TEST_CASE("ParallelForEach") {
+    for(std::uint32_t numThreads : {0u, 1u, 3u, 16u}) {
+        std::vector<int>                    values(1000, 0);
+
+        Components::ParallelForEach(
+            values.size(),
+            numThreads,
+            [&values](size_t index) {
+                values[index] += static_cast<int>(index);
+            }
+        );
+
+        for(size_t index = 0; index < values.size(); ++index)
+            CHECK(values[index] == static_cast<int>(index));
+    }
+
+    // Nothing to do
+    Components::ParallelForEach(0, 4, [](size_t) { throw std::runtime_error("Unexpected"); });
+}
+
+TEST_CASE("ParallelForEach - exceptions") {
+    for(std::uint32_t numThreads : {1u, 4u}) {
+        CHECK_THROWS_WITH(
+            Components::ParallelForEach(
+                100,
+                numThreads,
+                [](size_t index) {
+                    if(index == 10 || index == 90)
+                        throw std::runtime_error(std::to_string(index));
+                }
+            ),
+            "10"
+        );
+    }
+
+    CHECK_THROWS_WITH(Components::ParallelForEach(10, 1, std::function<void (size_t)>()), "func");
+}
@@ -5,20 +5,23 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <random>
+
 #include "../MedianEstimator.h"
 #include "../../TestHelpers.h"
 
 namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
 
 template <bool InterpolateValuesV, typename InputT, typename TransformedT>
-void Test(std::vector<InputT> inputs, TransformedT median) {
+void Test(std::vector<InputT> inputs, TransformedT median, Components::MedianEstimatorMode mode=Components::MedianEstimatorMode::Exact) {
     // ----------------------------------------------------------------------
     using MedianEstimator                   = NS::Featurizers::Components::MedianEstimator<InputT, TransformedT, InterpolateValuesV>;
     using MedianAnnotationData              = NS::Featurizers::Components::MedianAnnotationData<TransformedT>;
     // ----------------------------------------------------------------------
 
     NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
-    MedianEstimator                         estimator(pAllColumnAnnotations, 0);
+    MedianEstimator                         estimator(pAllColumnAnnotations, 0, true, mode);
     std::vector<std::vector<InputT>>        inputBatches{std::move(inputs)};
 
     NS::TestHelpers::Train(estimator, inputBatches);
@@ -49,6 +52,61 @@ TEST_CASE("nullable ints") {
     Test<false, nonstd::optional<int>>({1, 2, nonstd::optional<int>(), nonstd::optional<int>(), nonstd::optional<int>(), 3, nonstd::optional<int>(), 4}, 2);
 }
 
+TEST_CASE("ints - approximate") {
+    // The sketch is exact until it fills up
+    Test<true, int>({1, 2, 3, 4, 5}, 3, Components::MedianEstimatorMode::Approximate);
+    Test<true, int>({4, 1, 3, 2}, 2.5, Components::MedianEstimatorMode::Approximate);
+    Test<false, int>({4, 1, 3, 2}, 2, Components::MedianEstimatorMode::Approximate);
+    Test<true, nonstd::optional<int>>({1, 2, nonstd::optional<int>(), 3, nonstd::optional<int>(), 4}, 2.5, Components::MedianEstimatorMode::Approximate);
+}
+
+std::vector<int> GetShuffledValues(int cValues) {
+    std::vector<int>                        result;
+
+    result.reserve(static_cast<size_t>(cValues));
+
+    for(int i = 0; i < cValues; ++i)
+        result.emplace_back(i);
+
+    std::shuffle(result.begin(), result.end(), std::mt19937(42));
+    return result;
+}
+
+TEST_CASE("Large input") {
+    Test<true, int>(GetShuffledValues(100001), 50000);
+    Test<true, int>(GetShuffledValues(100000), 49999.5);
+    Test<false, int>(GetShuffledValues(100000), 49999);
+}
+
+TEST_CASE("Large input - approximate") {
+    using MedianEstimator                   = Components::MedianEstimator<int, double>;
+
+    for(double rankError : {0.05, 0.01, 0.001}) {
+        NS::AnnotationMapsPtr const         pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+        MedianEstimator                     estimator(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::Approximate, rankError);
+        std::vector<std::vector<int>>       inputBatches{GetShuffledValues(100000)};
+
+        NS::TestHelpers::Train(estimator, inputBatches);
+
+        // The values are the ranks, so the error is the rank error
+        CHECK(std::abs(estimator.get_annotation_data().Median - 49999.5) <= rankError * 100000);
+    }
+}
+
+TEST_CASE("Invalid mode") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK_THROWS_WITH(Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, static_cast<Components::MedianEstimatorMode>(0)), "mode");
+    CHECK_THROWS_WITH(Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::NumValues), "mode");
+    CHECK_THROWS_WITH((Components::MedianEstimator<std::string, std::string, false>(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::Approximate)), "mode");
+
+    CHECK_THROWS_WITH(Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::Approximate, 0.0), "rankError");
+    CHECK_THROWS_WITH(Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::Approximate, 1.0), "rankError");
+
+    // The rank error is ignored in exact mode
+    CHECK_NOTHROW(Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::Exact, 0.0));
+}
+
 TEST_CASE("strings") {
     Test<false, std::string, std::string>({"1", "2", "3", "4", "5"}, "3");
     Test<false, std::string, std::string>({"1", "2", "3", "4"}, "2");
@@ -65,6 +123,11 @@ TEST_CASE("No elements during training") {
 
     estimator.begin_training();
     CHECK_THROWS_WITH(estimator.complete_training(), "No elements were provided during training");
+
+    NS::Featurizers::Components::MedianEstimator<int>   approximateEstimator(pAllColumnAnnotations, 0, true, Components::MedianEstimatorMode::Approximate);
+
+    approximateEstimator.begin_training();
+    CHECK_THROWS_WITH(approximateEstimator.complete_training(), "No elements were provided during training");
 }
 
 TEST_CASE("No valid elements during training") {
@@ -0,0 +1,54 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "../MurmurHash3Batch.h"
+
+namespace NS = Microsoft::Featurizer;
+
+template <size_t NumBytesV>
+struct Bytes {
+    unsigned char                           Data[NumBytesV];
+};
+
+template <size_t NumBytesV>
+void Test(std::uint32_t seed, std::uint32_t expected) {
+    Bytes<NumBytesV>                        value;
+    unsigned char const                     source[] = { 0x21, 0x43, 0x65, 0x87, 0x00, 0x11, 0x22, 0x33 };
+
+    std::memcpy(value.Data, source, NumBytesV);
+
+    // 2 full batches and a partial batch
+    std::vector<Bytes<NumBytesV>> const     input(NS::Featurizers::Components::MurmurHash3BatchLanes * 2 + 3, value);
+    std::vector<std::uint32_t>              output(input.size());
+
+    NS::Featurizers::Components::MurmurHash3_x86_32_Batch(input.data(), input.size(), seed, output.data());
+
+    for(auto const &hash : output)
+        CHECK(hash == expected);
+}
+
+TEST_CASE("Reference values") {
+    Test<1>(0, 0x72661CF4);
+    Test<2>(0, 0xA0F7B07A);
+    Test<3>(0, 0x7E4A8634);
+    Test<4>(0, 0xF55B516B);
+    Test<8>(0x9747b28c, 0xA9BB2A0B);
+}
+
+TEST_CASE("Zero") {
+    std::uint32_t const                     value(0);
+    std::uint32_t                           hash;
+
+    NS::Featurizers::Components::MurmurHash3_x86_32_Batch(&value, 1, 0, &hash);
+    CHECK(hash == 0x2362F9DE);
+}
+
+TEST_CASE("Empty") {
+    NS::Featurizers::Components::MurmurHash3_x86_32_Batch(static_cast<std::uint32_t const *>(nullptr), 0, 0, nullptr);
+}
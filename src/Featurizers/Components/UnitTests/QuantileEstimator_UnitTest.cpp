@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <random>
+
+#include "../QuantileEstimator.h"
+#include "../../TestHelpers.h"
+#include "../../../3rdParty/optional.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+template <typename InputT>
+std::vector<double> Test(std::vector<InputT> inputs, std::vector<double> quantiles, double rankError=Components::QuantileEstimatorDefaultRankError) {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Components::QuantileEstimator<InputT>   estimator(pAllColumnAnnotations, 0, true, quantiles, rankError);
+    std::vector<std::vector<InputT>>        inputBatches{std::move(inputs)};
+
+    NS::TestHelpers::Train(estimator, inputBatches);
+
+    Components::QuantileAnnotationData const &          annotation(estimator.get_annotation_data());
+
+    CHECK(annotation.Quantiles == quantiles);
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    for(size_t index = 0; index < quantiles.size(); ++index)
+        CHECK(annotation.get_value(quantiles[index]) == annotation.Values[index]);
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+
+    return annotation.Values;
+}
+
+TEST_CASE("ints") {
+    CHECK(Test<int>({9, 1, 7, 3, 5}, {0.5, 0.25, 0.75, 0.0, 1.0}) == std::vector<double>{5.0, 3.0, 7.0, 1.0, 9.0});
+    CHECK(Test<int>({4, 1, 3, 2}, {0.5, 0.0}) == std::vector<double>{2.5, 1.0});
+    CHECK(Test<int>({4, 1, 3, 2}, {}).empty());
+}
+
+TEST_CASE("nullable") {
+    CHECK(Test<nonstd::optional<int>>({1, nonstd::optional<int>(), 2, 3, nonstd::optional<int>()}, {0.5}) == std::vector<double>{2.0});
+    CHECK(Test<float>({1.0f, std::nanf(""), 2.0f, 4.0f}, {0.5}) == std::vector<double>{2.0});
+}
+
+TEST_CASE("Large input") {
+    std::vector<int>                        values;
+
+    for(int i = 0; i < 100000; ++i)
+        values.emplace_back(i);
+
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+
+    std::vector<double> const               quantiles{0.1, 0.25, 0.5, 0.75, 0.9};
+
+    for(double rankError : {0.01, 0.001}) {
+        std::vector<double> const           results(Test<int>(values, quantiles, rankError));
+
+        // The values are the ranks, so the error is the rank error
+        for(size_t index = 0; index < quantiles.size(); ++index)
+            CHECK(std::abs(results[index] - quantiles[index] * 99999) <= rankError * 100000);
+    }
+}
+
+TEST_CASE("Invalid args") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK_THROWS_WITH(Components::QuantileEstimator<int>(pAllColumnAnnotations, 0, true, std::vector<double>{0.5, 1.5}), "quantiles");
+    CHECK_THROWS_WITH(Components::QuantileEstimator<int>(pAllColumnAnnotations, 0, true, std::vector<double>{-0.1}), "quantiles");
+    CHECK_THROWS_WITH(Components::QuantileEstimator<int>(pAllColumnAnnotations, 0, true, std::vector<double>{std::nan("")}), "quantiles");
+    CHECK_THROWS_WITH(Components::QuantileEstimator<int>(pAllColumnAnnotations, 0, true, std::vector<double>{0.5}, 0.0), "rankError");
+
+    CHECK_THROWS_WITH(Components::QuantileAnnotationData({0.5}, {}, 1), "values");
+    CHECK_THROWS_WITH(Components::QuantileAnnotationData({0.5}, {1.0}, 0), "count");
+    CHECK_THROWS_WITH(Components::QuantileAnnotationData({0.5}, {1.0}, 1).get_value(0.25), "quantile");
+}
+
+TEST_CASE("No elements during training") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Components::QuantileEstimator<int>      estimator(pAllColumnAnnotations, 0, true, std::vector<double>{0.5});
+
+    estimator.begin_training();
+    CHECK_THROWS_WITH(estimator.complete_training(), "No elements were provided during training");
+
+    CHECK_THROWS_WITH(
+        (Test<nonstd::optional<int>>({nonstd::optional<int>(), nonstd::optional<int>()}, {0.5})),
+        "No elements were provided during training"
+    );
+}
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <random>
+
+#include "../QuantileSketch.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+std::vector<double> GetShuffledValues(size_t cValues, unsigned int seed) {
+    std::vector<double>                     result;
+
+    result.reserve(cValues);
+
+    for(size_t i = 0; i < cValues; ++i)
+        result.emplace_back(static_cast<double>(i));
+
+    std::shuffle(result.begin(), result.end(), std::mt19937(seed));
+    return result;
+}
+
+TEST_CASE("Invalid args") {
+    CHECK_THROWS_WITH(Components::QuantileSketch(7), "k");
+    CHECK_THROWS_WITH(Components::QuantileSketch().median(), "The sketch is empty");
+    CHECK_THROWS_WITH(Components::QuantileSketch().update(std::nan("")), "value");
+
+    Components::QuantileSketch              sketch;
+
+    sketch.update(1.0);
+    CHECK_THROWS_WITH(sketch.quantile(-0.1), "q");
+    CHECK_THROWS_WITH(sketch.quantile(1.1), "q");
+    CHECK_THROWS_WITH(sketch.value_at_rank(1), "rank");
+    CHECK_THROWS_WITH(Components::QuantileSketch().value_at_rank(0), "The sketch is empty");
+    CHECK_THROWS_WITH(sketch.values_at_ranks({0, 1}), "ranks");
+    CHECK_THROWS_WITH(Components::QuantileSketch().values_at_ranks({0}), "The sketch is empty");
+
+    CHECK_THROWS_WITH(Components::QuantileSketch::GetKForRankError(0.0), "rankError");
+    CHECK_THROWS_WITH(Components::QuantileSketch::GetKForRankError(1.0), "rankError");
+    CHECK_THROWS_WITH(Components::QuantileSketch::GetKForRankError(1e-9), "rankError");
+}
+
+TEST_CASE("GetKForRankError") {
+    std::uint16_t const                     minK(Components::QuantileSketch::MinK);
+
+    CHECK(Components::QuantileSketch::GetKForRankError(0.9) == minK);
+    CHECK(Components::QuantileSketch::GetKForRankError(0.5) == 10);
+    CHECK(Components::QuantileSketch::GetKForRankError(0.01) == 500);
+    CHECK(Components::QuantileSketch::GetKForRankError(0.001) == 5000);
+}
+
+TEST_CASE("Exact") {
+    Components::QuantileSketch              sketch(16);
+
+    CHECK(sketch.empty());
+
+    sketch.update(5.0);
+    CHECK(sketch.median() == 5.0);
+
+    sketch.update(1.0);
+    CHECK(sketch.median() == 3.0);
+
+    sketch.update(10.0);
+    CHECK(sketch.median() == 5.0);
+    CHECK(sketch.quantile(0.0) == 1.0);
+    CHECK(sketch.quantile(1.0) == 10.0);
+    CHECK(sketch.quantile(0.25) == 3.0);
+    CHECK(sketch.value_at_rank(0) == 1.0);
+    CHECK(sketch.value_at_rank(1) == 5.0);
+    CHECK(sketch.value_at_rank(2) == 10.0);
+    CHECK(sketch.values_at_ranks({2, 0, 1}) == std::vector<double>{10.0, 1.0, 5.0});
+    CHECK(sketch.values_at_ranks({}).empty());
+
+    for(int i = 0; i < 13; ++i)
+        sketch.update(2.0);
+
+    CHECK(sketch.count() == 16);
+    CHECK(sketch.is_exact());
+    CHECK(sketch.median() == 2.0);
+
+    // Exceeding k begins compaction
+    sketch.update(2.0);
+    CHECK(sketch.count() == 17);
+    CHECK(sketch.is_exact() == false);
+    CHECK(sketch.num_retained() < 17);
+    CHECK(sketch.median() == 2.0);
+}
+
+TEST_CASE("Approximate") {
+    size_t const                            cValues(100000);
+    Components::QuantileSketch              sketch;
+
+    for(double value : GetShuffledValues(cValues, 42))
+        sketch.update(value);
+
+    CHECK(sketch.count() == cValues);
+    CHECK(sketch.is_exact() == false);
+    CHECK(sketch.num_retained() <= 3 * Components::QuantileSketch::DefaultK);
+
+    // The values are the ranks, so the error is the rank error
+    for(double q : {0.1, 0.25, 0.5, 0.75, 0.9})
+        CHECK(std::abs(sketch.quantile(q) - q * static_cast<double>(cValues - 1)) < 0.03 * static_cast<double>(cValues));
+
+    CHECK(sketch.quantile(0.0) < 0.01 * static_cast<double>(cValues));
+    CHECK(sketch.quantile(1.0) > 0.99 * static_cast<double>(cValues));
+
+    // Multiple ranks match the individual lookups
+    std::vector<std::uint64_t> const        ranks{0, cValues / 2 - 1, cValues / 2, cValues - 1};
+    std::vector<double> const               values(sketch.values_at_ranks(ranks));
+
+    REQUIRE(values.size() == ranks.size());
+
+    for(size_t index = 0; index < ranks.size(); ++index)
+        CHECK(values[index] == sketch.value_at_rank(ranks[index]));
+}
+
+TEST_CASE("Merge") {
+    std::vector<double> const               values(GetShuffledValues(100000, 7));
+    Components::QuantileSketch              sketch1;
+    Components::QuantileSketch              sketch2;
+
+    for(size_t i = 0; i < values.size(); ++i)
+        (i % 3 == 0 ? sketch1 : sketch2).update(values[i]);
+
+    sketch1.merge(sketch2);
+
+    CHECK(sketch1.count() == values.size());
+    CHECK(sketch1.num_retained() <= 3 * Components::QuantileSketch::DefaultK);
+    CHECK(std::abs(sketch1.median() - 50000.0) < 3000.0);
+
+    // Merging small sketches is exact
+    Components::QuantileSketch              small1;
+    Components::QuantileSketch              small2;
+
+    small1.update(1.0);
+    small1.update(4.0);
+    small2.update(2.0);
+    small2.update(3.0);
+
+    small1.merge(small2);
+    CHECK(small1.is_exact());
+    CHECK(small1.median() == 2.5);
+
+    small1.merge(small1);
+    CHECK(small1.count() == 8);
+    CHECK(small1.median() == 2.5);
+
+    small1.merge(Components::QuantileSketch());
+    CHECK(small1.count() == 8);
+}
+
+TEST_CASE("Serialization") {
+    Components::QuantileSketch              sketch(32);
+
+    for(double value : GetShuffledValues(1000, 3))
+        sketch.update(value);
+
+    NS::Archive                             out;
+
+    sketch.save(out);
+
+    NS::Archive                             in(out.commit());
+    Components::QuantileSketch              other(in);
+
+    CHECK(other == sketch);
+    CHECK(other.k() == 32);
+    CHECK(other.median() == sketch.median());
+
+    // Both sketches continue to evolve the same way
+    sketch.update(10.0);
+    other.update(10.0);
+    CHECK(other == sketch);
+}
+
+TEST_CASE("Serialization errors") {
+    // 64 levels, which would require weights that can't be represented
+    NS::Archive                             out;
+
+    NS::Traits<std::uint16_t>::serialize(out, 16);
+    NS::Traits<bool>::serialize(out, false);
+    NS::Traits<std::uint64_t>::serialize(out, 0);
+    NS::Traits<std::vector<std::vector<double>>>::serialize(out, std::vector<std::vector<double>>(64));
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(Components::QuantileSketch(in), "Invalid levels");
+
+    // Weights that don't match the count
+    NS::Archive                             out2;
+
+    NS::Traits<std::uint16_t>::serialize(out2, 16);
+    NS::Traits<bool>::serialize(out2, false);
+    NS::Traits<std::uint64_t>::serialize(out2, 3);
+    NS::Traits<std::vector<std::vector<double>>>::serialize(out2, std::vector<std::vector<double>>{{1.0, 2.0}});
+
+    NS::Archive                             in2(out2.commit());
+
+    CHECK_THROWS_WITH(Components::QuantileSketch(in2), "Invalid quantile sketch");
+
+    // Weights that overflow (4 values at level 62 wrap around to 0)
+    std::vector<std::vector<double>>        levels(63);
+
+    levels.back() = std::vector<double>{1.0, 2.0, 3.0, 4.0};
+
+    NS::Archive                             out3;
+
+    NS::Traits<std::uint16_t>::serialize(out3, 16);
+    NS::Traits<bool>::serialize(out3, false);
+    NS::Traits<std::uint64_t>::serialize(out3, 0);
+    NS::Traits<std::vector<std::vector<double>>>::serialize(out3, levels);
+
+    NS::Archive                             in3(out3.commit());
+
+    CHECK_THROWS_WITH(Components::QuantileSketch(in3), "Invalid quantile sketch");
+}
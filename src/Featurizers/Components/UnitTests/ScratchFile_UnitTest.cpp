@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cstdlib>
+#include <string>
+
+#include "../ScratchFile.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+TEST_CASE("Append and read") {
+    Components::ScratchFile                 file;
+    NS::Archive::ByteArray const            data1{1, 2, 3};
+    NS::Archive::ByteArray const            data2{4, 5, 6, 7};
+
+    CHECK(file.size() == 0);
+
+    CHECK(file.append(data1.data(), data1.size()) == 0);
+    CHECK(file.append(data2.data(), data2.size()) == 3);
+    CHECK(file.size() == 7);
+
+    CHECK(file.read(3, 4) == data2);
+    CHECK(file.read(0, 3) == data1);
+    CHECK(file.read(7, 0).empty());
+}
+
+TEST_CASE("Write") {
+    Components::ScratchFile                 file;
+    NS::Archive::ByteArray const            data{1, 2, 3, 4};
+    NS::Archive::ByteArray const            other{9, 8};
+
+    file.append(data.data(), data.size());
+    file.write(1, other.data(), other.size());
+
+    CHECK(file.read(0, 4) == NS::Archive::ByteArray{1, 9, 8, 4});
+    CHECK(file.size() == 4);
+
+    // Writing at the end extends the file
+    file.write(4, other.data(), other.size());
+    CHECK(file.size() == 6);
+    CHECK(file.read(4, 2) == other);
+}
+
+TEST_CASE("Invalid args") {
+    Components::ScratchFile                 file;
+    NS::Archive::ByteArray const            data{1, 2, 3};
+
+    file.append(data.data(), data.size());
+
+    CHECK_THROWS_WITH(file.append(nullptr, 2), "pBuffer");
+    CHECK_THROWS_WITH(file.write(4, data.data(), data.size()), "offset");
+    CHECK_THROWS_WITH(file.read(2, 2), "offset");
+    CHECK_THROWS_WITH(file.read(4, 0), "offset");
+}
+
+#if (!defined _WIN32)
+TEST_CASE("Temporary directory") {
+    char const * const                      pOriginal(std::getenv("TMPDIR"));
+    std::string const                       original(pOriginal ? pOriginal : "");
+
+    setenv("TMPDIR", "/this/directory/does/not/exist", 1);
+    CHECK_THROWS_WITH(Components::ScratchFile(), "The scratch file could not be created");
+
+    if(pOriginal)
+        setenv("TMPDIR", original.c_str(), 1);
+    else
+        unsetenv("TMPDIR");
+
+    Components::ScratchFile                 file;
+    NS::Archive::ByteArray const            data{1, 2, 3};
+
+    file.append(data.data(), data.size());
+    CHECK(file.read(0, 3) == data);
+}
+#endif
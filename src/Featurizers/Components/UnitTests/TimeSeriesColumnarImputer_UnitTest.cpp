@@ -0,0 +1,399 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <random>
+
+#include "../TimeSeriesColumnarImputer.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+using Imputer                               = Components::TimeSeriesColumnarImputer<double>;
+using Statistics                            = Components::TimeSeriesColumnarStatistics<double>;
+
+struct Rows {
+    std::vector<std::uint32_t>              grainIds;
+    std::vector<std::int64_t>               times;
+    std::vector<std::vector<double>>        values;
+    std::vector<std::vector<std::uint8_t>>  validity;
+
+    Rows(size_t cColumns) : values(cColumns), validity(cColumns) {}
+
+    void add(std::uint32_t grainId, std::int64_t time, std::vector<nonstd::optional<double>> const &row) {
+        size_t const                        index(times.size());
+
+        grainIds.push_back(grainId);
+        times.push_back(time);
+
+        for(size_t column = 0; column < row.size(); ++column) {
+            values[column].push_back(row[column] ? *row[column] : 0.0);
+            Components::AppendValidityBit(validity[column], index, static_cast<bool>(row[column]));
+        }
+    }
+
+    Components::TimeSeriesColumnarInput<double> view(void) const {
+        Components::TimeSeriesColumnarInput<double>         result{grainIds.data(), times.data(), times.size(), {}};
+
+        for(size_t column = 0; column < values.size(); ++column)
+            result.columns.push_back(Components::TimeSeriesValueColumn<double>{values[column].data(), validity[column].data()});
+
+        return result;
+    }
+};
+
+std::vector<nonstd::optional<double>> GetRow(Components::TimeSeriesColumnarOutput<double> const &output, size_t row) {
+    std::vector<nonstd::optional<double>>   result;
+
+    for(size_t column = 0; column < output.values.size(); ++column) {
+        if(output.is_valid(column, row))
+            result.emplace_back(output.values[column][row]);
+        else
+            result.emplace_back();
+    }
+
+    return result;
+}
+
+TEST_CASE("Validity bitmap") {
+    std::vector<std::uint8_t>               bitmap;
+
+    for(size_t index = 0; index < 20; ++index)
+        Components::AppendValidityBit(bitmap, index, index % 3 == 0);
+
+    CHECK(bitmap.size() == 3);
+
+    for(size_t index = 0; index < 20; ++index)
+        CHECK(Components::IsValidityBitSet(bitmap.data(), index) == (index % 3 == 0));
+
+    CHECK(Components::IsValidityBitSet(nullptr, 7));
+}
+
+TEST_CASE("Invalid arguments") {
+    CHECK_THROWS_WITH(Imputer(0, 1, Components::TimeSeriesImputeStrategy::Forward, false), "frequency");
+    CHECK_THROWS_WITH(Imputer(1, 0, Components::TimeSeriesImputeStrategy::Forward, false), "cColumns");
+    CHECK_THROWS_WITH(Imputer(1, 1, Components::TimeSeriesImputeStrategy::NumValues, false), "strategy");
+    CHECK_THROWS_WITH(Imputer(1, 2, Components::TimeSeriesImputeStrategy::Median, false, {{1.0}}), "medianValues");
+    CHECK_THROWS_WITH(Statistics(0), "cColumns");
+
+    Imputer                                 imputer(1, 2, Components::TimeSeriesImputeStrategy::Forward, false);
+    Rows                                    rows(1);
+    Imputer::OutputType                     output(2);
+
+    rows.add(0, 0, {1.0});
+    CHECK_THROWS_WITH(imputer.execute(rows.view(), output), "input");
+
+    Imputer::OutputType                     badOutput(1);
+
+    CHECK_THROWS_WITH(imputer.flush(badOutput), "output");
+
+    Rows                                    maxGrainRows(2);
+    Statistics                              statistics(2);
+
+    maxGrainRows.add(std::numeric_limits<std::uint32_t>::max(), 0, {1.0, 1.0});
+    CHECK_THROWS_WITH(imputer.execute(maxGrainRows.view(), output), "grainId");
+    CHECK_THROWS_WITH(statistics.fit(maxGrainRows.view()), "grainId");
+}
+
+TEST_CASE("Forward - gaps and grains") {
+    Imputer                                 imputer(10, 2, Components::TimeSeriesImputeStrategy::Forward, false);
+    Rows                                    rows(2);
+    Imputer::OutputType                     output(2);
+
+    rows.add(0, 0, {1.0, 2.0});
+    rows.add(1, 100, {nonstd::optional<double>(), 5.0});
+    rows.add(0, 30, {nonstd::optional<double>(), 3.0});
+    rows.add(1, 110, {6.0, nonstd::optional<double>()});
+
+    imputer.execute(rows.view(), output);
+    imputer.flush(output);
+
+    REQUIRE(output.size() == 6);
+    CHECK(output.added == std::vector<std::uint8_t>{0, 0, 1, 1, 0, 0});
+    CHECK(output.grainIds == std::vector<std::uint32_t>{0, 1, 0, 0, 0, 1});
+    CHECK(output.times == std::vector<std::int64_t>{0, 100, 10, 20, 30, 110});
+
+    CHECK(GetRow(output, 0) == std::vector<nonstd::optional<double>>{1.0, 2.0});
+    CHECK(GetRow(output, 1) == std::vector<nonstd::optional<double>>{nonstd::optional<double>(), 5.0});
+    CHECK(GetRow(output, 2) == std::vector<nonstd::optional<double>>{1.0, 2.0});
+    CHECK(GetRow(output, 3) == std::vector<nonstd::optional<double>>{1.0, 2.0});
+    CHECK(GetRow(output, 4) == std::vector<nonstd::optional<double>>{1.0, 3.0});
+    CHECK(GetRow(output, 5) == std::vector<nonstd::optional<double>>{6.0, 5.0});
+}
+
+TEST_CASE("Backward - across batches") {
+    Imputer                                 imputer(1, 2, Components::TimeSeriesImputeStrategy::Backward, false);
+    Imputer::OutputType                     output(2);
+
+    Rows                                    batch1(2);
+
+    batch1.add(0, 0, {1.0, nonstd::optional<double>()});
+    batch1.add(0, 2, {nonstd::optional<double>(), 4.0});
+
+    imputer.execute(batch1.view(), output);
+
+    // The first column of the last two rows is still unknown
+    REQUIRE(output.size() == 1);
+    CHECK(output.times == std::vector<std::int64_t>{0});
+    CHECK(GetRow(output, 0) == std::vector<nonstd::optional<double>>{1.0, 4.0});
+
+    Rows                                    batch2(2);
+
+    batch2.add(0, 3, {5.0, nonstd::optional<double>()});
+    batch2.add(0, 4, {nonstd::optional<double>(), nonstd::optional<double>()});
+
+    imputer.execute(batch2.view(), output);
+
+    REQUIRE(output.size() == 3);
+    CHECK(output.added == std::vector<std::uint8_t>{0, 1, 0});
+    CHECK(GetRow(output, 1) == std::vector<nonstd::optional<double>>{5.0, 4.0});
+    CHECK(GetRow(output, 2) == std::vector<nonstd::optional<double>>{5.0, 4.0});
+
+    imputer.flush(output);
+
+    REQUIRE(output.size() == 5);
+    CHECK(output.times == std::vector<std::int64_t>{0, 1, 2, 3, 4});
+    CHECK(GetRow(output, 3) == std::vector<nonstd::optional<double>>{5.0, nonstd::optional<double>()});
+    CHECK(GetRow(output, 4) == std::vector<nonstd::optional<double>>{nonstd::optional<double>(), nonstd::optional<double>()});
+}
+
+TEST_CASE("Interpolate") {
+    Imputer                                 imputer(1, 2, Components::TimeSeriesImputeStrategy::Interpolate, false);
+    Imputer::OutputType                     output(2);
+    Rows                                    rows(2);
+
+    rows.add(0, 0, {nonstd::optional<double>(), 1.0});
+    rows.add(0, 1, {2.0, nonstd::optional<double>()});
+    rows.add(0, 4, {8.0, nonstd::optional<double>()});
+
+    imputer.execute(rows.view(), output);
+
+    // The second column doesn't have a value after the first row yet
+    REQUIRE(output.size() == 1);
+    CHECK(GetRow(output, 0) == std::vector<nonstd::optional<double>>{nonstd::optional<double>(), 1.0});
+
+    Rows                                    batch2(2);
+
+    batch2.add(0, 5, {nonstd::optional<double>(), 6.0});
+
+    imputer.execute(batch2.view(), output);
+
+    REQUIRE(output.size() == 5);
+    CHECK(output.added == std::vector<std::uint8_t>{0, 0, 1, 1, 0});
+    CHECK(GetRow(output, 1) == std::vector<nonstd::optional<double>>{2.0, 2.0});
+    CHECK(GetRow(output, 2) == std::vector<nonstd::optional<double>>{4.0, 3.0});
+    CHECK(GetRow(output, 3) == std::vector<nonstd::optional<double>>{6.0, 4.0});
+    CHECK(GetRow(output, 4) == std::vector<nonstd::optional<double>>{8.0, 5.0});
+
+    imputer.flush(output);
+
+    REQUIRE(output.size() == 6);
+    CHECK(GetRow(output, 5) == std::vector<nonstd::optional<double>>{nonstd::optional<double>(), 6.0});
+}
+
+TEST_CASE("Median") {
+    Statistics                              statistics(1);
+    Rows                                    training(1);
+
+    training.add(0, 0, {1.0});
+    training.add(0, 5, {3.0});
+    training.add(2, 10, {10.0});
+    training.add(2, 12, {nonstd::optional<double>()});
+
+    statistics.fit(training.view());
+
+    CHECK(statistics.get_frequency() == 2);
+
+    Imputer::MedianValues                   medians(statistics.get_median_values());
+
+    CHECK(medians == Imputer::MedianValues{{2.0}, {}, {10.0}});
+
+    Rows                                    rows(1);
+
+    rows.add(0, 0, {nonstd::optional<double>()});
+    rows.add(2, 0, {nonstd::optional<double>()});
+    rows.add(1, 0, {nonstd::optional<double>()});
+
+    SECTION("Error") {
+        Imputer                             imputer(statistics.get_frequency(), 1, Components::TimeSeriesImputeStrategy::Median, false, medians);
+        Imputer::OutputType                 output(1);
+
+        CHECK_THROWS_WITH(imputer.execute(rows.view(), output), "Invalid key");
+    }
+
+    SECTION("Suppress error") {
+        Imputer                             imputer(statistics.get_frequency(), 1, Components::TimeSeriesImputeStrategy::Median, true, medians);
+        Imputer::OutputType                 output(1);
+
+        imputer.execute(rows.view(), output);
+
+        REQUIRE(output.size() == 3);
+        CHECK(GetRow(output, 0) == std::vector<nonstd::optional<double>>{2.0});
+        CHECK(GetRow(output, 1) == std::vector<nonstd::optional<double>>{10.0});
+        CHECK(GetRow(output, 2) == std::vector<nonstd::optional<double>>{nonstd::optional<double>()});
+    }
+}
+
+TEST_CASE("Statistics errors") {
+    Statistics                              statistics(1);
+    Rows                                    rows(1);
+
+    rows.add(0, 0, {nonstd::optional<double>()});
+
+    statistics.fit(rows.view());
+
+    CHECK_THROWS_WITH(statistics.get_frequency(), "Frequency couldn't be inferred from training data.");
+    CHECK_THROWS_WITH(statistics.get_median_values(), "No valid value found for median computation.");
+    CHECK_THROWS_WITH(statistics.fit(rows.view()), "Input stream not in chronological order.");
+}
+
+TEST_CASE("Chronological order") {
+    Imputer                                 imputer(1, 1, Components::TimeSeriesImputeStrategy::Forward, false);
+    Imputer::OutputType                     output(1);
+    Rows                                    rows(1);
+
+    rows.add(0, 5, {1.0});
+    rows.add(0, 4, {1.0});
+
+    CHECK_THROWS_WITH(imputer.execute(rows.view(), output), "Input stream not in chronological order.");
+}
+
+void TestParity(Components::TimeSeriesImputeStrategy strategy) {
+    using StringTransformer                 = Components::TimeSeriesImputerEstimator::Transformer;
+    using StringInput                       = Components::TimeSeriesImputerEstimatorInputType;
+    using StringOutput                      = Components::TimeSeriesImputerEstimatorTransformedType;
+
+    size_t const                            cColumns(3);
+    std::uint32_t const                     cGrains(4);
+    std::int64_t const                      frequency(10);
+
+    std::mt19937                            generator(42);
+    std::uniform_int_distribution<int>      valueDist(0, 40);
+    std::uniform_int_distribution<int>      gapDist(1, 3);
+    std::uniform_int_distribution<std::uint32_t>    grainDist(0, cGrains - 1);
+
+    Rows                                    rows(cColumns);
+    std::vector<StringInput>                stringRows;
+    std::vector<std::int64_t>               lastTimes(cGrains, 0);
+
+    auto const                              addRow(
+        [&rows, &stringRows](std::uint32_t grainId, std::int64_t time, std::vector<nonstd::optional<double>> const &row) {
+            std::vector<nonstd::optional<std::string>>      stringRow;
+
+            for(auto const &value : row) {
+                if(value)
+                    stringRow.emplace_back(std::to_string(*value));
+                else
+                    stringRow.emplace_back();
+            }
+
+            rows.add(grainId, time, row);
+            stringRows.emplace_back(
+                std::chrono::system_clock::time_point(std::chrono::system_clock::duration(time)),
+                std::vector<std::string>{std::to_string(grainId)},
+                std::move(stringRow)
+            );
+        }
+    );
+
+    // Every grain has at least one value per column so that the medians are defined
+    for(std::uint32_t grainId = 0; grainId < cGrains; ++grainId)
+        addRow(grainId, 0, std::vector<nonstd::optional<double>>(cColumns, 1.0));
+
+    for(int i = 0; i < 500; ++i) {
+        std::uint32_t const                 grainId(grainDist(generator));
+        std::vector<nonstd::optional<double>>   row;
+
+        lastTimes[grainId] += gapDist(generator) * frequency;
+
+        for(size_t column = 0; column < cColumns; ++column) {
+            int const                       value(valueDist(generator));
+
+            // Roughly half of the values are null
+            if(value % 2)
+                row.emplace_back();
+            else
+                row.emplace_back(value / 4.0);
+        }
+
+        addRow(grainId, lastTimes[grainId], row);
+    }
+
+    // Columnar
+    Statistics                              statistics(cColumns);
+
+    statistics.fit(rows.view());
+
+    Imputer::MedianValues                   medians(statistics.get_median_values());
+    Imputer                                 imputer(frequency, cColumns, strategy, false, medians);
+    Imputer::OutputType                     output(cColumns);
+
+    imputer.execute(rows.view(), output);
+    imputer.flush(output);
+
+    // Strings
+    std::map<std::vector<std::string>, std::vector<double>>     stringMedians;
+
+    for(std::uint32_t grainId = 0; grainId < cGrains; ++grainId)
+        stringMedians[std::vector<std::string>{std::to_string(grainId)}] = medians[grainId];
+
+    StringTransformer                       transformer(
+        std::chrono::system_clock::duration(frequency),
+        std::vector<NS::TypeId>(cColumns, NS::TypeId::Float64),
+        strategy,
+        false,
+        stringMedians
+    );
+
+    std::vector<StringOutput>               expected;
+    auto const                              callback(
+        [&expected](StringOutput value) {
+            expected.emplace_back(std::move(value));
+        }
+    );
+
+    for(auto const &row : stringRows)
+        transformer.execute(row, callback);
+
+    transformer.flush(callback);
+
+    // The string transformer flushes grains in key order, which matches the grain
+    // id order for single digit ids.
+    REQUIRE(output.size() == expected.size());
+
+    for(size_t row = 0; row < expected.size(); ++row) {
+        StringOutput const &                expectedRow(expected[row]);
+
+        CHECK((output.added[row] != 0) == std::get<0>(expectedRow));
+        CHECK(output.times[row] == std::get<1>(expectedRow).time_since_epoch().count());
+        CHECK(std::to_string(output.grainIds[row]) == std::get<2>(expectedRow)[0]);
+
+        for(size_t column = 0; column < cColumns; ++column) {
+            nonstd::optional<std::string> const &       expectedValue(std::get<3>(expectedRow)[column]);
+
+            REQUIRE(output.is_valid(column, row) == static_cast<bool>(expectedValue));
+
+            if(expectedValue)
+                CHECK(output.values[column][row] == Approx(std::stod(*expectedValue)));
+        }
+    }
+}
+
+TEST_CASE("Parity with string transformer - Forward") {
+    TestParity(Components::TimeSeriesImputeStrategy::Forward);
+}
+
+TEST_CASE("Parity with string transformer - Backward") {
+    TestParity(Components::TimeSeriesImputeStrategy::Backward);
+}
+
+TEST_CASE("Parity with string transformer - Median") {
+    TestParity(Components::TimeSeriesImputeStrategy::Median);
+}
+
+TEST_CASE("Parity with string transformer - Interpolate") {
+    TestParity(Components::TimeSeriesImputeStrategy::Interpolate);
+}
@@ -9,10 +9,15 @@ function(Impl)
     get_filename_component(_this_path ${CMAKE_CURRENT_LIST_FILE} DIRECTORY)
 
     add_library(FeaturizersComponentsCode STATIC
+        ${_this_path}/../CivilCalendar.h
+        ${_this_path}/../CompactStringIndexMap.h
         ${_this_path}/../Components.h
+        ${_this_path}/../DenseIndexMap.h
         ${_this_path}/../DocumentStatisticsEstimator.h
         ${_this_path}/../DocumentStatisticsEstimator.cpp
         ${_this_path}/../GrainEstimatorImpl.h
+        ${_this_path}/../GrainInterner.h
+        ${_this_path}/../GrainPartitioner.h
         ${_this_path}/../HistogramEstimator.h
         ${_this_path}/../ImputerTransformer.h
         ${_this_path}/../IndexMapEstimator.h
@@ -21,11 +26,17 @@ function(Impl)
         ${_this_path}/../MedianEstimator.h
         ${_this_path}/../MinMaxEstimator.h
         ${_this_path}/../ModeEstimator.h
+        ${_this_path}/../MurmurHash3Batch.h
         ${_this_path}/../NormUpdaters.h
         ${_this_path}/../OrderEstimator.h
         ${_this_path}/../PipelineExecutionEstimatorImpl.h
+        ${_this_path}/../QuantileEstimator.h
+        ${_this_path}/../QuantileSketch.h
+        ${_this_path}/../ScratchFile.h
+        ${_this_path}/../ScratchFile.cpp
         ${_this_path}/../StandardDeviationEstimator.h
         ${_this_path}/../StatisticalMetricsEstimator.h
+        ${_this_path}/../TimeSeriesColumnarImputer.h
         ${_this_path}/../TimeSeriesFrequencyEstimator.h
         ${_this_path}/../TimeSeriesImputerTransformer.h
         ${_this_path}/../TimeSeriesMedianEstimator.h
@@ -35,6 +46,10 @@ function(Impl)
         ${_this_path}/../Details/EstimatorTraits.h
         ${_this_path}/../Details/PipelineExecutionEstimatorImpl_details.h
     )
+
+    # GrainPartitioner.h uses std::thread
+    find_package(Threads REQUIRED)
+    target_link_libraries(FeaturizersComponentsCode PUBLIC Threads::Threads)
 endfunction()
 
 Impl()
@@ -15,9 +15,9 @@ namespace Featurizers {
 // |  CountVectorizerTransformer
 // |
 // ----------------------------------------------------------------------
-CountVectorizerTransformer::CountVectorizerTransformer(IndexMapType map, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max) :
+CountVectorizerTransformer::CountVectorizerTransformer(CompactIndexMapType map, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max) :
     _labels(
-        std::move([&map](void) ->  IndexMapType & {
+        std::move([&map](void) ->  CompactIndexMapType & {
             if (map.size() == 0) {
                 throw std::invalid_argument("Index map is empty!");
             }
@@ -60,7 +60,7 @@ CountVectorizerTransformer::CountVectorizerTransformer(Archive &ar) :
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMapType           labels(Traits<IndexMapType>::deserialize(ar));
+            CompactIndexMapType    labels(Traits<CompactIndexMapType>::deserialize(ar));
             bool                   binary(Traits<bool>::deserialize(ar));
 
             bool                   lower(Traits<bool>::deserialize(ar));
@@ -103,48 +103,35 @@ bool CountVectorizerTransformer::operator==(CountVectorizerTransformer const &ot
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 void CountVectorizerTransformer::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    AppearanceMapType appearanceMap;
+    _arena.decorate_and_parse(input, _parse_func, _lower, _analyzer, _regex, _ngram_min, _ngram_max);
 
-    std::string processedInput(Components::DocumentDecorator(input, _lower, _analyzer, _regex, _ngram_min, _ngram_max));
+    std::vector<std::tuple<std::uint32_t, std::uint32_t>> & appearances(_arena.Results);
 
-    _parse_func(
-        processedInput,
-        [&appearanceMap] (std::string::const_iterator iter_start, std::string::const_iterator iter_end) {
+    _arena.enumerate_unique_terms(
+        [this, &appearances](std::string const &word, std::uint32_t numAppearances) {
+            std::uint32_t const * const     pLabel(_labels.find(word));
 
-            AppearanceMapType::iterator iter_appearance(appearanceMap.find(std::make_tuple(iter_start, iter_end)));
+            if (pLabel != nullptr)
+                appearances.emplace_back(*pLabel, _binary ? 1 : numAppearances);
+        }
+    );
 
-            if (iter_appearance != appearanceMap.end()) {
-                ++iter_appearance->second;
-            } else {
-                appearanceMap.insert(std::make_pair(std::make_tuple(iter_start, iter_end), 1));
-            }
+    // SparseVectorEncoding requires ValueEncoding to be in order
+    // so we sort the scratch results before creating SparseVectorEncoding
+    std::sort(appearances.begin(), appearances.end(),
+        [](std::tuple<std::uint32_t, std::uint32_t> const &a, std::tuple<std::uint32_t, std::uint32_t> const &b) {
+            return std::get<0>(a) < std::get<0>(b);
         }
     );
 
     std::vector<SparseVectorEncoding<std::uint32_t>::ValueEncoding> result;
 
-    for (auto const & wordAppearance : appearanceMap) {
-        std::string const word = std::string(std::get<0>(wordAppearance.first), std::get<1>(wordAppearance.first));
+    result.reserve(appearances.size());
 
-        typename IndexMapType::const_iterator const      iter_label(_labels.find(word));
+    for (auto const & appearance : appearances)
+        result.emplace_back(std::get<1>(appearance), std::get<0>(appearance));
 
-        if (iter_label != _labels.end()) {
-            if (_binary) {
-                result.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(1, iter_label->second));
-            } else {
-                result.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(wordAppearance.second, iter_label->second));
-            }
-        }
-    }
-    // SparseVectorEncoding requires ValueEncoding to be in order
-    // so we sort result before creating SparseVectorEncoding
-    std::sort(result.begin(), result.end(),
-        [](SparseVectorEncoding<std::uint32_t>::ValueEncoding const &a, SparseVectorEncoding<std::uint32_t>::ValueEncoding const &b) {
-            return a.Index < b.Index;
-        }
-    );
     callback(SparseVectorEncoding<std::uint32_t>(_labels.size(), std::move(result)));
-
 }
 
 } // namespace Featurizers
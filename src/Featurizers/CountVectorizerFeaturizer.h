@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "Components/CompactStringIndexMap.h"
 #include "Components/DocumentStatisticsEstimator.h"
 #include "../Traits.h"
 #include "../Strings.h"
@@ -27,6 +28,7 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                           = StandardTransformer<std::string, SparseVectorEncoding<std::uint32_t>>;
     using IndexMapType                       = std::unordered_map<std::string, std::uint32_t>;
+    using CompactIndexMapType                = Components::CompactStringIndexMap;
     using AnalyzerMethod                     = Components::AnalyzerMethod;
 
     // ----------------------------------------------------------------------
@@ -34,7 +36,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    CountVectorizerTransformer(IndexMapType map, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max);
+    CountVectorizerTransformer(CompactIndexMapType map, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max);
     CountVectorizerTransformer(Archive &ar);
 
     ~CountVectorizerTransformer(void) override = default;
@@ -51,8 +53,6 @@ private:
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using IterRangeType                      = std::tuple<std::string::const_iterator, std::string::const_iterator>;
-    using AppearanceMapType                  = typename std::map<IterRangeType, std::uint32_t, Components::IterRangeComp>;
     using StringIterator                     = std::string::const_iterator;
     using ParseFunctionType                  = std::function<
                                                    void (std::string const &,
@@ -64,7 +64,7 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    IndexMapType const                       _labels;
+    CompactIndexMapType const                _labels;
     bool const                               _binary;
 
     //data for execute same parse function as in documentstatisticestimator
@@ -76,6 +76,9 @@ private:
 
     ParseFunctionType const                  _parse_func;
 
+    // Scratch memory reused across calls to `execute_impl`
+    Components::DocumentScratchArena<std::uint32_t>  _arena;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methodsa
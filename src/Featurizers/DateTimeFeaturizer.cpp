@@ -3,6 +3,11 @@
 // Licensed under the MIT License
 // ----------------------------------------------------------------------
 #include "DateTimeFeaturizer.h"
+
+#include <map>
+#include <mutex>
+#include <numeric>
+
 #ifdef _WIN32
     #include <direct.h>
     #include <Windows.h>
@@ -15,13 +20,6 @@
 #   include <unistd.h>
 #endif
 
-#ifdef _MSC_VER
-inline struct tm *gmtime_r(time_t const* const timer, struct tm* const  result) {
-    return gmtime_s(result, timer) == 0 ? result : nullptr;
-}
-
-#endif
-
 namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
@@ -31,67 +29,53 @@ namespace Featurizers {
 // |  TimePoint
 // |
 // ----------------------------------------------------------------------
+StringView const TimePoint::WeekDayLabels[7] = {
+    "Sunday", "Monday", "Tuesday", "Wednesday",
+    "Thursday", "Friday", "Saturday"
+};
+
+StringView const TimePoint::MonthLabels[12] = {
+    "January", "February", "March", "April", "May", "June",
+    "July", "August", "September", "October", "November", "December"
+};
+
+StringView const TimePoint::AmPmLabels[2] = {
+    "am", "pm"
+};
+
 TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
-    // Get to a tm to get what we need.
-    // Eventually C++202x will have expanded chrono support that might
-    // have what we need, but not yet!
-    std::tm tmt;
-    time_t tt = std::chrono::system_clock::to_time_t(sysTime);
-    std::tm* res = gmtime_r(&tt, &tmt);
-    if (res) {
-        year = static_cast<std::int32_t>(tmt.tm_year) + 1900;
-        month = static_cast<std::uint8_t>(tmt.tm_mon) + 1;
-        day = static_cast<std::uint8_t>(tmt.tm_mday);
-        hour = static_cast<std::uint8_t>(tmt.tm_hour);
-        minute = static_cast<std::uint8_t>(tmt.tm_min);
-        second = static_cast<std::uint8_t>(tmt.tm_sec);
-        amPm = hour < 12 ? 0 : 1;
-        hour12 = hour <= 12 ? hour : hour - 12;
-        dayOfWeek = static_cast<std::uint8_t>(tmt.tm_wday);
-        dayOfYear = static_cast<std::uint16_t>(tmt.tm_yday);
-        weekOfMonth = (day - 1) / 7;
-        quarterOfYear = (month + 2) / 3;
-        halfOfYear = month <= 6 ? 1 : 2;
-
-        date::year_month_day ymd = date::year_month_day{ date::year(year), date::month(month), date::day(day) };
-        date::sys_days days(ymd);
-        iso_week::year_weeknum_weekday iso_date = iso_week::year_weeknum_weekday{ days };
-
-        // calculate the day of the quarter
-        if(month <= 3){
-            date::year_month_day startOfQuarter = date::year_month_day{ date::year(year), date::month(1), date::day(1) };
-            dayOfQuarter = static_cast<uint8_t>(date::round<date::days>(days - startOfQuarter.operator date::sys_days()).count() + 1);
-        }
-        else if(month <= 6){
-            date::year_month_day startOfQuarter = date::year_month_day{ date::year(year), date::month(4), date::day(1) };
-            dayOfQuarter = static_cast<uint8_t>(date::round<date::days>(days - startOfQuarter.operator date::sys_days()).count() + 1);
-        }
-        else if(month <= 9){
-            date::year_month_day startOfQuarter = date::year_month_day{ date::year(year), date::month(7), date::day(1) };
-            dayOfQuarter = static_cast<uint8_t>(date::round<date::days>(days - startOfQuarter.operator date::sys_days()).count() + 1);
-        }
-        else{
-            date::year_month_day startOfQuarter = date::year_month_day{ date::year(year), date::month(10), date::day(1) };
-            dayOfQuarter = static_cast<uint8_t>(date::round<date::days>(days - startOfQuarter.operator date::sys_days()).count() + 1);
-        }
+    std::int32_t                            days;
+    std::int32_t                            secondsOfDay;
 
-        weekIso = static_cast<std::uint8_t>(iso_date.weeknum().operator unsigned());
-        yearIso = iso_date.year().operator int();
-        monthLabel = _months[month - 1];
-        amPmLabel = amPm ? "pm" : "am";
-        dayOfWeekLabel = _weekDays[dayOfWeek];
-        holidayName = "";
-        isPaidTimeOff = 0;               // TODO
-    }
-    else
-    {
-        if (tt < 0) {
-            throw std::invalid_argument("Dates prior to 1970 are not supported.");
-        }
-        else {
-            throw std::invalid_argument("Unknown error converting input date.");
-        }
-    }
+    Components::SplitTimePoint(sysTime, days, secondsOfDay);
+    Initialize(Components::CivilFromDays(days), secondsOfDay);
+}
+
+TimePoint::TimePoint(Components::CivilDate const &date, std::int32_t secondsOfDay) {
+    Initialize(date, secondsOfDay);
+}
+
+void TimePoint::Initialize(Components::CivilDate const &date, std::int32_t secondsOfDay) {
+    year = date.year;
+    month = date.month;
+    day = date.day;
+    hour = static_cast<std::uint8_t>(secondsOfDay / 3600);
+    minute = static_cast<std::uint8_t>((secondsOfDay / 60) % 60);
+    second = static_cast<std::uint8_t>(secondsOfDay % 60);
+    amPm = hour < 12 ? 0 : 1;
+    hour12 = hour <= 12 ? hour : hour - 12;
+    dayOfWeek = date.dayOfWeek;
+    dayOfQuarter = date.dayOfQuarter;
+    dayOfYear = date.dayOfYear;
+    weekOfMonth = (day - 1) / 7;
+    quarterOfYear = date.quarterOfYear;
+    halfOfYear = month <= 6 ? 1 : 2;
+    weekIso = date.weekIso;
+    yearIso = date.yearIso;
+    monthLabel = MonthLabels[month - 1];
+    amPmLabel = AmPmLabels[amPm];
+    dayOfWeekLabel = WeekDayLabels[dayOfWeek];
+    isPaidTimeOff = 0;               // TODO
 }
 
 // ----------------------------------------------------------------------
@@ -139,7 +123,7 @@ namespace {
         return binaryPath + "\\Data\\DateTimeFeaturizer\\";
     }
 
-    bool EnumCountries(
+    bool EnumCountryFiles(
         std::function<bool (std::string)> const &callback,
         std::string const &optionalDataRootDir
     ) {
@@ -221,7 +205,7 @@ namespace {
         return binaryPath + "/Data/DateTimeFeaturizer/";
     }
 
-    bool EnumCountries(
+    bool EnumCountryFiles(
         std::function<bool (std::string)> const &callback,
         std::string const &optionalDataRootDir
     ) {
@@ -250,6 +234,25 @@ namespace {
 
 #endif
 
+bool EnumCountries(
+    std::function<bool (std::string)> const &callback,
+    std::string const &optionalDataRootDir
+) {
+    // Holidays for the default data are compiled into the binary; only
+    // enumerate files when a custom data root dir is provided. Embedded
+    // countries are reported with the name of the file they were generated
+    // from so that matching behaves the same in both cases.
+    if(optionalDataRootDir.empty() == false)
+        return EnumCountryFiles(callback, optionalDataRootDir);
+
+    for(std::uint32_t index = 0; index < HolidayTables::CountryCount; ++index) {
+        if(callback(std::string(HolidayTables::Countries[index].name) + ".json") == false)
+            return false;
+    }
+
+    return true;
+}
+
 nlohmann::json GetJsonStream(std::string const & jsonFilename) {
     nlohmann::json                          holidaysByCountry;
     std::ifstream                           file(jsonFilename);
@@ -295,6 +298,8 @@ bool DoesCountryMatch(std::string const &country, std::string query) {
 
 } // anonymous namespace
 
+constexpr std::uint16_t const DateTimeTransformer::DefaultDayCacheSize;
+
 DateTimeTransformer::DateTimeTransformer(Archive &ar) :
     DateTimeTransformer(ar, "") {
 }
@@ -314,56 +319,23 @@ DateTimeTransformer::DateTimeTransformer(Archive &ar, std::string dataRootDir) :
     ) {
 }
 
-DateTimeTransformer::DateTimeTransformer(std::string optionalCountryName, std::string optionalDataRootDir):
+DateTimeTransformer::DateTimeTransformer(std::string optionalCountryName, std::string optionalDataRootDir, std::uint16_t dayCacheSize):
     _countryName(std::move(optionalCountryName)),
-    _dateHolidayMap(
-        [this, &optionalDataRootDir]() {
-            if(_countryName.empty())
-                return HolidayMap();
-
-            // Get the corresponding file
-            std::string                         filename;
-
-            if(
-                EnumCountries(
-                    [this, &filename](std::string country) {
-                        if(DoesCountryMatch(_countryName, country)) {
-                            filename = std::move(country);
-
-                            // Don't continue processing
-                            return false;
-                        }
-
-                        return true;
-                    },
-                    optionalDataRootDir
-                )
-            ) {
-                // A true return value means that we have enumerated through all of the country names and didn't find a match
-                throw std::invalid_argument(_countryName);
-            }
-
-            JsonStream holidaysByCountry = GetJsonStream(GetDataDirectory(optionalDataRootDir) + filename);
-
-            //Convert Jsonstream to std::unordered_map
-            //Note that the map keys are generated with "Date" and "Holiday" so no need to check existence
-            std::vector<std::int64_t> dateVector = holidaysByCountry.at("Date").get<std::vector<std::int64_t>>();
-            std::vector<std::string> nameVector = holidaysByCountry.at("Holiday").get<std::vector<std::string>>();
-            HolidayMap                      holidays;
-
-            assert(dateVector.size() == nameVector.size());
-            for (unsigned long iter = 0; iter < dateVector.size(); ++iter) {
-                holidays[dateVector[iter]] = nameVector[iter];
-            }
-
-            return holidays;
+    _pHolidayTable(GetHolidayTable(_countryName, optionalDataRootDir)),
+    _dayCache(
+        [&dayCacheSize](void) {
+            // The cache is direct-mapped, so the size must be a power of 2
+            if((dayCacheSize & (dayCacheSize - 1)) != 0)
+                throw std::invalid_argument("dayCacheSize");
+
+            return DayCache(dayCacheSize);
         }()
     ) {
 
 }
 
 bool DateTimeTransformer::operator==(DateTimeTransformer const &other) const {
-    return _dateHolidayMap == other._dateHolidayMap;
+    return *_pHolidayTable == *other._pHolidayTable;
 }
 
 void DateTimeTransformer::save(Archive & ar) const /*override*/ {
@@ -378,28 +350,281 @@ void DateTimeTransformer::save(Archive & ar) const /*override*/ {
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction const &callback) /*override*/ {
-    static constexpr long long const        secondsPerDay(60 * 60 * 24);
+void DateTimeTransformer::execute_batch(std::int64_t const *pSecondsSinceEpoch, size_t cInputs, TimePointColumns const &columns) {
+    if(pSecondsSinceEpoch == nullptr && cInputs != 0)
+        throw std::invalid_argument("pSecondsSinceEpoch");
+
+    DayCacheEntry                           uncached;
+
+    for(size_t index = 0; index < cInputs; ++index) {
+        std::int32_t                        days;
+        std::int32_t                        secondsOfDay;
+
+        Components::SplitSeconds(pSecondsSinceEpoch[index], days, secondsOfDay);
+
+        DayCacheEntry const &               entry(GetDay(days, uncached));
+        TimePoint const                     result(entry.date, secondsOfDay);
+
+        if(columns.pYear) columns.pYear[index] = result.year;
+        if(columns.pMonth) columns.pMonth[index] = result.month;
+        if(columns.pDay) columns.pDay[index] = result.day;
+        if(columns.pHour) columns.pHour[index] = result.hour;
+        if(columns.pMinute) columns.pMinute[index] = result.minute;
+        if(columns.pSecond) columns.pSecond[index] = result.second;
+        if(columns.pAmPm) columns.pAmPm[index] = result.amPm;
+        if(columns.pHour12) columns.pHour12[index] = result.hour12;
+        if(columns.pDayOfWeek) columns.pDayOfWeek[index] = result.dayOfWeek;
+        if(columns.pDayOfQuarter) columns.pDayOfQuarter[index] = result.dayOfQuarter;
+        if(columns.pDayOfYear) columns.pDayOfYear[index] = result.dayOfYear;
+        if(columns.pWeekOfMonth) columns.pWeekOfMonth[index] = result.weekOfMonth;
+        if(columns.pQuarterOfYear) columns.pQuarterOfYear[index] = result.quarterOfYear;
+        if(columns.pHalfOfYear) columns.pHalfOfYear[index] = result.halfOfYear;
+        if(columns.pWeekIso) columns.pWeekIso[index] = result.weekIso;
+        if(columns.pYearIso) columns.pYearIso[index] = result.yearIso;
+        if(columns.pMonthLabel) columns.pMonthLabel[index] = static_cast<std::uint8_t>(result.month - 1);
+        if(columns.pAmPmLabel) columns.pAmPmLabel[index] = result.amPm;
+        if(columns.pDayOfWeekLabel) columns.pDayOfWeekLabel[index] = result.dayOfWeek;
+        if(columns.pHolidayName) columns.pHolidayName[index] = entry.holidayId;
+        if(columns.pIsPaidTimeOff) columns.pIsPaidTimeOff[index] = result.isPaidTimeOff;
+    }
+}
 
-    TimePoint                               result(input);
+StringView DateTimeTransformer::GetHolidayName(std::uint16_t holidayId) const {
+    if(holidayId > _pHolidayTable->cNames)
+        throw std::invalid_argument("holidayId");
 
-    if (!_dateHolidayMap.empty()) {
-        // Values in the holiday map are based on midnight of the corresponding day. When looking up holidays for this time,
-        // remove any seconds since midnight.
-        long long const                     totalSeconds(std::chrono::time_point_cast<std::chrono::seconds>(input).time_since_epoch().count());
-        int64_t const                       holidayKey(static_cast<int64_t>((static_cast<double>(totalSeconds) / secondsPerDay)) * secondsPerDay);
-        HolidayMap::const_iterator const    iter(_dateHolidayMap.find(holidayKey));
+    return _pHolidayTable->GetName(holidayId);
+}
 
-        if(iter != _dateHolidayMap.end())
-            result.holidayName = iter->second;
-    }
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction const &callback) /*override*/ {
+    std::int32_t                            days;
+    std::int32_t                            secondsOfDay;
 
+    Components::SplitTimePoint(input, days, secondsOfDay);
+
+    DayCacheEntry                           uncached;
+    DayCacheEntry const &                   entry(GetDay(days, uncached));
+    TimePoint                               result(entry.date, secondsOfDay);
+
+    result.holidayName = entry.holidayName;
     callback(std::move(result));
 }
 
 void DateTimeTransformer::flush_impl(CallbackFunction const &) /*override*/ {
 }
 
+DateTimeTransformer::DayCacheEntry const & DateTimeTransformer::GetDay(std::int32_t days, DayCacheEntry &uncached) {
+    DayCacheEntry &                         entry(_dayCache.empty() ? uncached : _dayCache[static_cast<size_t>(days) & (_dayCache.size() - 1)]);
+
+    if(entry.isValid == false || entry.days != days) {
+        entry.days = days;
+        entry.date = Components::CivilFromDays(days);
+        entry.holidayId = _pHolidayTable->Find(days);
+        entry.holidayName = _pHolidayTable->GetName(entry.holidayId);
+        entry.isValid = true;
+    }
+
+    return entry;
+}
+
+/*static*/ DateTimeTransformer::HolidayTablePtr DateTimeTransformer::GetHolidayTable(std::string const &countryName, std::string const &optionalDataRootDir) {
+    if(countryName.empty()) {
+        static HolidayTablePtr const        pEmptyTable(std::make_shared<HolidayTable>());
+
+        return pEmptyTable;
+    }
+
+    // Get the corresponding country
+    std::string                             country;
+
+    if(
+        EnumCountries(
+            [&countryName, &country](std::string name) {
+                if(DoesCountryMatch(countryName, name)) {
+                    country = std::move(name);
+
+                    // Don't continue processing
+                    return false;
+                }
+
+                return true;
+            },
+            optionalDataRootDir
+        )
+    ) {
+        // A true return value means that we have enumerated through all of the country names and didn't find a match
+        throw std::invalid_argument(countryName);
+    }
+
+    // Tables are shared by all transformers for the same (data root dir, country) and
+    // released when the last of those transformers is destroyed.
+    using Key                               = std::pair<std::string, std::string>;
+    using Tables                            = std::map<Key, std::weak_ptr<HolidayTable const>>;
+
+    static std::mutex                       tablesMutex;
+    static Tables                           tables;
+
+    std::lock_guard<std::mutex> const       lock(tablesMutex);
+    Key                                     key(optionalDataRootDir, std::move(country));
+    Tables::iterator                        iter(tables.find(key));
+
+    if(iter != tables.end()) {
+        HolidayTablePtr                     pTable(iter->second.lock());
+
+        if(pTable)
+            return pTable;
+    }
+
+    HolidayTablePtr                         pTable(CreateHolidayTable(key.second, key.first));
+
+    // Remove the tables that are no longer in use
+    for(Tables::iterator i = tables.begin(); i != tables.end(); ) {
+        if(i->second.expired())
+            i = tables.erase(i);
+        else
+            ++i;
+    }
+
+    tables[std::move(key)] = pTable;
+
+    return pTable;
+}
+
+/*static*/ DateTimeTransformer::HolidayTablePtr DateTimeTransformer::CreateHolidayTable(std::string const &country, std::string const &optionalDataRootDir) {
+    std::shared_ptr<HolidayTable>           pTable(std::make_shared<HolidayTable>());
+    HolidayTable &                          table(*pTable);
+
+    if(optionalDataRootDir.empty()) {
+        std::string const                   name(RemoveCountryExtension(country));
+        HolidayTables::CountryHolidays const * pCountry(
+            std::find_if(
+                HolidayTables::Countries,
+                HolidayTables::Countries + HolidayTables::CountryCount,
+                [&name](HolidayTables::CountryHolidays const &value) { return name == value.name; }
+            )
+        );
+
+        table.pDays = pCountry->pDays;
+        table.pNameIds = pCountry->pNameIds;
+        table.cEntries = pCountry->cEntries;
+        table.pNames = HolidayTables::Names;
+        table.cNames = HolidayTables::NameCount;
+
+        return HolidayTablePtr(std::move(pTable));
+    }
+
+    JsonStream holidaysByCountry = GetJsonStream(GetDataDirectory(optionalDataRootDir) + country);
+
+    //Note that the map keys are generated with "Date" and "Holiday" so no need to check existence
+    std::vector<std::int64_t> dateVector = holidaysByCountry.at("Date").get<std::vector<std::int64_t>>();
+    std::vector<std::string> nameVector = holidaysByCountry.at("Holiday").get<std::vector<std::string>>();
+
+    if(dateVector.size() != nameVector.size())
+        throw std::runtime_error("Invalid holiday data");
+
+    static constexpr std::int64_t const     secondsPerDay(60 * 60 * 24);
+
+    // Sort by day; when there are multiple entries for the same day, the last one wins
+    std::vector<size_t>                     indexes(dateVector.size());
+
+    std::iota(indexes.begin(), indexes.end(), static_cast<size_t>(0));
+    std::stable_sort(
+        indexes.begin(),
+        indexes.end(),
+        [&dateVector](size_t a, size_t b) { return dateVector[a] < dateVector[b]; }
+    );
+
+    std::unordered_map<std::string, std::uint16_t> nameIds;
+
+    for(size_t index : indexes) {
+        // Values are based on midnight of the corresponding day; other values can never match
+        // a lookup.
+        std::int64_t const                  date(dateVector[index]);
+
+        if(date % secondsPerDay != 0)
+            continue;
+
+        std::string &                       name(nameVector[index]);
+        auto                                iter(nameIds.find(name));
+
+        if(iter == nameIds.end()) {
+            // Holiday ids are the name index + 1, as 0 indicates that a day isn't a holiday
+            if(table.nameStrings.size() >= std::numeric_limits<std::uint16_t>::max())
+                throw std::runtime_error("Too many holiday names");
+
+            iter = nameIds.emplace(name, static_cast<std::uint16_t>(table.nameStrings.size())).first;
+            table.nameStrings.emplace_back(std::move(name));
+        }
+
+        std::int32_t const                  day(static_cast<std::int32_t>(date / secondsPerDay));
+
+        if(table.days.empty() == false && table.days.back() == day)
+            table.nameIds.back() = iter->second;
+        else {
+            table.days.push_back(day);
+            table.nameIds.push_back(iter->second);
+        }
+    }
+
+    table.names.reserve(table.nameStrings.size());
+
+    for(std::string const &name : table.nameStrings)
+        table.names.push_back({name.data(), static_cast<std::uint32_t>(name.size())});
+
+    table.pDays = table.days.data();
+    table.pNameIds = table.nameIds.data();
+    table.cEntries = table.days.size();
+    table.pNames = table.names.data();
+    table.cNames = table.names.size();
+
+    return HolidayTablePtr(std::move(pTable));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  DateTimeTransformer::HolidayTable
+// |
+// ----------------------------------------------------------------------
+bool DateTimeTransformer::HolidayTable::operator==(HolidayTable const &other) const {
+    if(cEntries != other.cEntries)
+        return false;
+
+    for(size_t index = 0; index < cEntries; ++index) {
+        if(pDays[index] != other.pDays[index])
+            return false;
+
+        HolidayTables::HolidayName const &  thisName(pNames[pNameIds[index]]);
+        HolidayTables::HolidayName const &  otherName(other.pNames[other.pNameIds[index]]);
+
+        if(StringView(thisName.pData, thisName.size) != StringView(otherName.pData, otherName.size))
+            return false;
+    }
+
+    return true;
+}
+
+std::uint16_t DateTimeTransformer::HolidayTable::Find(std::int32_t day) const {
+    std::int32_t const * const              pEnd(pDays + cEntries);
+    std::int32_t const * const              pDay(std::lower_bound(pDays, pEnd, day));
+
+    if(pDay == pEnd || *pDay != day)
+        return 0;
+
+    return static_cast<std::uint16_t>(pNameIds[pDay - pDays] + 1);
+}
+
+StringView DateTimeTransformer::HolidayTable::GetName(std::uint16_t id) const {
+    if(id == 0)
+        return StringView();
+
+    HolidayTables::HolidayName const &      name(pNames[id - 1]);
+
+    return StringView(name.pData, name.size);
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  DateTimeEstimator
@@ -7,10 +7,13 @@
 #include <chrono>
 #include <ctime>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <stdio.h>
 
@@ -28,7 +31,6 @@
 #   pragma warning(disable: 4244) // conversion from 'unsigned int' to 'unsigned char', possible loss of data
 #endif
 
-#include "../3rdParty/iso_week.h"
 #include "../3rdParty/json.h"
 
 #if (defined __clang__)
@@ -38,13 +40,78 @@
 #endif
 
 #include "../Archive.h"
+#include "Components/CivilCalendar.h"
 #include "Components/InferenceOnlyFeaturizerImpl.h"
+#include "DateTimeFeaturizerData/HolidayTables.h"
 #include "../Traits.h"
 
 namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         StringView
+///  \brief         Non-owning reference to a string, used for TimePoint labels
+///                 so that producing a TimePoint doesn't allocate memory.
+///
+///                 Labels refer to static tables or to data owned by the
+///                 DateTimeTransformer that produced them; use `str()` to
+///                 create a copy that outlives the transformer.
+///
+class StringView {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using const_iterator                    = char const *;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    constexpr StringView(void) : _pData(""), _size(0) {}
+    constexpr StringView(char const *pData, size_t size) : _pData(pData), _size(size) {}
+
+    template <size_t SizeV>
+    constexpr StringView(char const (&literal)[SizeV]) : _pData(literal), _size(SizeV - 1) {}
+
+    StringView(std::string const &value) : _pData(value.data()), _size(value.size()) {}
+
+    char const * data(void) const { return _pData; }
+    size_t size(void) const { return _size; }
+    bool empty(void) const { return _size == 0; }
+
+    const_iterator begin(void) const { return _pData; }
+    const_iterator end(void) const { return _pData + _size; }
+
+    std::string str(void) const { return std::string(_pData, _size); }
+    operator std::string(void) const { return str(); }
+
+    friend bool operator==(StringView const &a, StringView const &b) {
+        return a._size == b._size && (a._size == 0 || std::memcmp(a._pData, b._pData, a._size) == 0);
+    }
+
+    friend bool operator!=(StringView const &a, StringView const &b) {
+        return (a == b) == false;
+    }
+
+    friend std::ostream & operator<<(std::ostream &os, StringView const &value) {
+        return os.write(value._pData, static_cast<std::streamsize>(value._size));
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    char const *                            _pData;
+    size_t                                  _size;
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \struct        TimePoint
 ///  \brief         Struct to hold various components of DateTime information
@@ -66,10 +133,10 @@ struct TimePoint {
     std::uint8_t halfOfYear = 0;    // 1 if date is prior to July 1, 2 otherwise
     std::uint8_t weekIso = 0;       // ISO week, see below for details
     std::int32_t yearIso = 0;      // ISO year, see details later
-    std::string monthLabel = "";    // calendar month as string, 'January' through 'December'
-    std::string amPmLabel = "";     // 'am' if hour is before noon (12 pm), 'pm' otherwise
-    std::string dayOfWeekLabel = "";// day of week as string
-    std::string holidayName = "";   // If a country is provided, we check if the date is a holiday
+    StringView monthLabel;          // calendar month as string, 'January' through 'December'
+    StringView amPmLabel;           // 'am' if hour is before noon (12 pm), 'pm' otherwise
+    StringView dayOfWeekLabel;      // day of week as string
+    StringView holidayName;         // If a country is provided, we check if the date is a holiday
     std::uint8_t isPaidTimeOff = 0; // If its a holiday, is it PTO
 
     // ISO year and week are defined in ISO 8601, see Wikipedia.ISO for details.
@@ -79,6 +146,7 @@ struct TimePoint {
     // January 4. As such, ISO years may differ from calendar years.
 
     TimePoint(const std::chrono::system_clock::time_point& sysTime);
+    TimePoint(Components::CivilDate const &date, std::int32_t secondsOfDay);
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimePoint);
 
@@ -90,16 +158,50 @@ struct TimePoint {
         SUNDAY = 0, MONDAY, TUESDAY, WEDNESDAY, THURSDAY, FRIDAY, SATURDAY
     };
 
+    static StringView const WeekDayLabels[7];
+    static StringView const MonthLabels[12];
+    static StringView const AmPmLabels[2];
+
 private:
-    const std::string _weekDays[7] = {
-        "Sunday", "Monday", "Tuesday", "Wednesday",
-        "Thursday", "Friday", "Saturday"
-    };
+    void Initialize(Components::CivilDate const &date, std::int32_t secondsOfDay);
+};
 
-    const std::string _months[12] = {
-        "January", "February", "March", "April", "May", "June",
-        "July", "August", "September", "October", "November", "December"
-    };
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TimePointColumns
+///  \brief         Struct-of-arrays output for `DateTimeTransformer::execute_batch`;
+///                 there is one column for each `TimePoint` field. Each non-null
+///                 pointer must reference a buffer with at least `cInputs` elements;
+///                 columns that are null are not populated.
+///
+///                 Labels are written as codes: `monthLabel` indexes
+///                 `TimePoint::MonthLabels`, `amPmLabel` indexes `TimePoint::AmPmLabels`
+///                 and `dayOfWeekLabel` indexes `TimePoint::WeekDayLabels`. Holidays
+///                 are written as ids that can be passed to
+///                 `DateTimeTransformer::GetHolidayName`, where 0 means that the date
+///                 is not a holiday.
+///
+struct TimePointColumns {
+    std::int32_t *                          pYear = nullptr;
+    std::uint8_t *                          pMonth = nullptr;
+    std::uint8_t *                          pDay = nullptr;
+    std::uint8_t *                          pHour = nullptr;
+    std::uint8_t *                          pMinute = nullptr;
+    std::uint8_t *                          pSecond = nullptr;
+    std::uint8_t *                          pAmPm = nullptr;
+    std::uint8_t *                          pHour12 = nullptr;
+    std::uint8_t *                          pDayOfWeek = nullptr;
+    std::uint8_t *                          pDayOfQuarter = nullptr;
+    std::uint16_t *                         pDayOfYear = nullptr;
+    std::uint16_t *                         pWeekOfMonth = nullptr;
+    std::uint8_t *                          pQuarterOfYear = nullptr;
+    std::uint8_t *                          pHalfOfYear = nullptr;
+    std::uint8_t *                          pWeekIso = nullptr;
+    std::int32_t *                          pYearIso = nullptr;
+    std::uint8_t *                          pMonthLabel = nullptr;
+    std::uint8_t *                          pAmPmLabel = nullptr;
+    std::uint8_t *                          pDayOfWeekLabel = nullptr;
+    std::uint16_t *                         pHolidayName = nullptr;
+    std::uint8_t *                          pIsPaidTimeOff = nullptr;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -107,6 +209,18 @@ private:
 ///  \brief         A Transformer that takes a chrono::system_clock::time_point and
 ///                 returns a struct with all the data split out.
 ///
+///                 Date-level fields (and the holiday name) are memoized in a
+///                 small direct-mapped cache keyed by the day number, so that
+///                 consecutive inputs falling on the same day only compute the
+///                 time-of-day fields. A `dayCacheSize` of 0 disables the cache.
+///
+///                 Holidays are read from the tables compiled into the binary
+///                 (see `DateTimeFeaturizerData/HolidayTables.h`) unless a
+///                 data root dir is provided, in which case they are loaded from
+///                 the JSON files in that directory. Holiday tables are
+///                 immutable and shared by all transformers created for the
+///                 same country and data root dir within the process.
+///
 class DateTimeTransformer : public Components::InferenceOnlyTransformerImpl<std::chrono::system_clock::time_point, TimePoint> {
 public:
     // ----------------------------------------------------------------------
@@ -116,12 +230,19 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                          = Components::InferenceOnlyTransformerImpl<std::chrono::system_clock::time_point, TimePoint>;
 
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint16_t const    DefaultDayCacheSize = 64;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    DateTimeTransformer(std::string optionalCountryName, std::string optionalDataRootDir=std::string());
+    DateTimeTransformer(std::string optionalCountryName, std::string optionalDataRootDir=std::string(), std::uint16_t dayCacheSize=DefaultDayCacheSize);
     DateTimeTransformer(Archive &ar);
 
     // This constructor is necessary at the dataRootDir may be different between
@@ -136,6 +257,21 @@ public:
 
     void save(Archive & ar) const override;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cInputs` values, expressed as the number of
+    ///                 seconds since the epoch, into columns.
+    ///
+    void execute_batch(std::int64_t const *pSecondsSinceEpoch, size_t cInputs, TimePointColumns const &columns);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetHolidayName
+    ///  \brief         Returns the name associated with a holiday id written by
+    ///                 `execute_batch`; the name is valid for the lifetime of this
+    ///                 object.
+    ///
+    StringView GetHolidayName(std::uint16_t holidayId) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -143,7 +279,43 @@ private:
     // |
     // ----------------------------------------------------------------------
     using JsonStream                        = nlohmann::json;
-    using HolidayMap                        = std::unordered_map<std::int64_t, std::string>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \struct        HolidayTable
+    ///  \brief         Holidays sorted by day number. The pointers refer either
+    ///                 to the embedded tables or to the storage owned by this
+    ///                 object when the holidays were loaded from a JSON file.
+    ///
+    struct HolidayTable {
+        std::int32_t const *                pDays = nullptr;
+        std::uint16_t const *               pNameIds = nullptr;
+        size_t                              cEntries = 0;
+        HolidayTables::HolidayName const *  pNames = nullptr;
+        size_t                              cNames = 0;
+
+        std::vector<std::int32_t>           days;
+        std::vector<std::uint16_t>          nameIds;
+        std::vector<std::string>            nameStrings;
+        std::vector<HolidayTables::HolidayName> names;
+
+        bool operator==(HolidayTable const &other) const;
+
+        // Returns the index of the holiday name + 1, or 0 if the day isn't a holiday
+        std::uint16_t Find(std::int32_t day) const;
+        StringView GetName(std::uint16_t id) const;
+    };
+
+    using HolidayTablePtr                   = std::shared_ptr<HolidayTable const>;
+
+    struct DayCacheEntry {
+        bool                                isValid = false;
+        std::int32_t                        days = 0;
+        Components::CivilDate               date;
+        std::uint16_t                       holidayId = 0;
+        StringView                          holidayName;
+    };
+
+    using DayCache                          = std::vector<DayCacheEntry>;
 
     // ----------------------------------------------------------------------
     // |
@@ -151,7 +323,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     std::string const                       _countryName;
-    HolidayMap const                        _dateHolidayMap;
+    HolidayTablePtr const                   _pHolidayTable;
+
+    // Runtime-only state; not serialized and not considered in operator==
+    DayCache                                _dayCache;
 
     // ----------------------------------------------------------------------
     // |
@@ -160,6 +335,16 @@ private:
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, CallbackFunction const &callback) override;
     void flush_impl(CallbackFunction const &callback) override;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetDay
+    ///  \brief         Returns the cached entry for the day, populating it if
+    ///                 necessary. `uncached` is used when the cache is disabled.
+    ///
+    DayCacheEntry const & GetDay(std::int32_t days, DayCacheEntry &uncached);
+
+    static HolidayTablePtr GetHolidayTable(std::string const &countryName, std::string const &optionalDataRootDir);
+    static HolidayTablePtr CreateHolidayTable(std::string const &country, std::string const &optionalDataRootDir);
 };
 
 class DateTimeEstimator :
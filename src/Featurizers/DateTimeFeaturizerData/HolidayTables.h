@@ -0,0 +1,49 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace HolidayTables {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        HolidayName
+///  \brief         Entry in the holiday name pool shared by all countries.
+///
+struct HolidayName {
+    char const *                            pData;
+    std::uint32_t                           size;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        CountryHolidays
+///  \brief         Holidays for a single country, sorted by day number
+///                 (days since 1970-01-01). `pNameIds[i]` is the index into
+///                 `Names` of the holiday that falls on `pDays[i]`.
+///
+struct CountryHolidays {
+    char const *                            name;
+    std::int32_t const *                    pDays;
+    std::uint16_t const *                   pNameIds;
+    std::uint32_t                           cEntries;
+};
+
+// The tables are produced by `Tools/HolidayTableGenerator.py` from the JSON files
+// in `GeneratedCode` and defined in `GeneratedCode/HolidayTables.cpp`. Countries
+// are sorted by name.
+extern HolidayName const                    Names[];
+extern std::uint32_t const                  NameCount;
+
+extern CountryHolidays const                Countries[];
+extern std::uint32_t const                  CountryCount;
+
+} // namespace HolidayTables
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,206 @@
+# ----------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License
+# ----------------------------------------------------------------------
+"""Generates C++ holiday tables based on the JSON files created by JsonGenerator.py"""
+
+import glob
+import json
+import os
+import sys
+import textwrap
+
+import CommonEnvironment
+from CommonEnvironment import CommandLine
+from CommonEnvironment.StreamDecorator import StreamDecorator
+
+# ----------------------------------------------------------------------
+_script_fullpath                            = CommonEnvironment.ThisFullpath()
+_script_dir, _script_name                   = os.path.split(_script_fullpath)
+# ----------------------------------------------------------------------
+
+SECONDS_PER_DAY                             = 60 * 60 * 24
+VALUES_PER_LINE                             = 16
+
+# ----------------------------------------------------------------------
+@CommandLine.EntryPoint(
+)
+@CommandLine.Constraints(
+    output_stream=None,
+)
+def EntryPoint(
+    output_stream=sys.stdout,
+):
+    """Generates C++ holiday tables based on the JSON files created by JsonGenerator.py"""
+
+    with StreamDecorator(output_stream).DoneManager(
+        line_prefix="",
+        prefix="\nResults: ",
+        suffix="\n",
+    ) as dm:
+        Generate(os.path.join(_script_dir, "..", "GeneratedCode"))
+
+        return dm.result
+
+# ----------------------------------------------------------------------
+def Generate(generated_dir):
+    """Writes HolidayTables.cpp based on the JSON files in `generated_dir`"""
+
+    with open(os.path.join(generated_dir, "HolidayTables.cpp"), "w") as f:
+        f.write(_GenerateContent(generated_dir))
+
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+def _GenerateContent(json_dir):
+    names = []
+    name_ids = {}
+    countries = []
+
+    for json_filename in sorted(glob.glob(os.path.join(json_dir, "*.json"))):
+        country_name = os.path.splitext(os.path.basename(json_filename))[0]
+
+        with open(json_filename) as f:
+            content = json.load(f)
+
+        # Later entries for the same day replace earlier ones
+        holidays = {}
+
+        for date, name in zip(content["Date"], content["Holiday"]):
+            assert date % SECONDS_PER_DAY == 0, (json_filename, date)
+            holidays[date // SECONDS_PER_DAY] = name
+
+        days = sorted(holidays.keys())
+        ids = []
+
+        for day in days:
+            name = holidays[day]
+
+            name_id = name_ids.get(name, None)
+            if name_id is None:
+                name_id = len(names)
+                name_ids[name] = name_id
+                names.append(name)
+
+            ids.append(name_id)
+
+        countries.append((country_name, days, ids))
+
+    # Holiday ids exposed by the DateTimeTransformer are the name index + 1
+    assert len(names) < 2 ** 16 - 1, len(names)
+
+    # ----------------------------------------------------------------------
+    def Values(values):
+        lines = []
+
+        for index in range(0, len(values), VALUES_PER_LINE):
+            lines.append("    {},".format(", ".join(str(value) for value in values[index:index + VALUES_PER_LINE])))
+
+        return "\n".join(lines)
+
+    # ----------------------------------------------------------------------
+    def Literal(value):
+        # Escape everything outside of printable ASCII so that the output doesn't
+        # depend on the encoding of the source file.
+        result = []
+
+        for b in value.encode("utf-8"):
+            if b in (ord('"'), ord("\\")):
+                result.append("\\{}".format(chr(b)))
+            elif 0x20 <= b < 0x7f:
+                result.append(chr(b))
+            else:
+                result.append('\\{:03o}'.format(b))
+
+        return '"{}"'.format("".join(result))
+
+    # ----------------------------------------------------------------------
+
+    country_tables = []
+    country_entries = []
+
+    for index, (country_name, days, ids) in enumerate(countries):
+        country_tables.append(
+            textwrap.dedent(
+                """\
+                // {name}
+                std::int32_t const Days{index}[] = {{
+                {days}
+                }};
+
+                std::uint16_t const NameIds{index}[] = {{
+                {ids}
+                }};
+                """,
+            ).format(
+                name=country_name,
+                index=index,
+                days=Values(days),
+                ids=Values(ids),
+            ),
+        )
+
+        country_entries.append(
+            "    {{ {}, Days{}, NameIds{}, {} }},".format(
+                Literal(country_name),
+                index,
+                index,
+                len(days),
+            ),
+        )
+
+    return textwrap.dedent(
+        """\
+        // ----------------------------------------------------------------------
+        // Copyright (c) Microsoft Corporation. All rights reserved.
+        // Licensed under the MIT License
+        // ----------------------------------------------------------------------
+
+        // This file was generated by Tools/{script_name}; do not edit it directly.
+
+        #include "../HolidayTables.h"
+
+        namespace Microsoft {{
+        namespace Featurizer {{
+        namespace Featurizers {{
+        namespace HolidayTables {{
+
+        namespace {{
+
+        {country_tables}
+        }} // anonymous namespace
+
+        HolidayName const Names[] = {{
+        {names}
+        }};
+
+        std::uint32_t const NameCount = {name_count};
+
+        CountryHolidays const Countries[] = {{
+        {country_entries}
+        }};
+
+        std::uint32_t const CountryCount = {country_count};
+
+        }} // namespace HolidayTables
+        }} // namespace Featurizers
+        }} // namespace Featurizer
+        }} // namespace Microsoft
+        """,
+    ).format(
+        script_name=_script_name,
+        country_tables="\n".join(country_tables),
+        names="\n".join("    {{ {}, {} }},".format(Literal(name), len(name.encode("utf-8"))) for name in names),
+        name_count=len(names),
+        country_entries="\n".join(country_entries),
+        country_count=len(countries),
+    )
+
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+    try:
+        sys.exit(CommandLine.Main())
+    except KeyboardInterrupt:
+        pass
@@ -18,6 +18,8 @@ from CommonEnvironment import CommandLine
 from CommonEnvironment import FileSystem
 from CommonEnvironment.StreamDecorator import StreamDecorator
 
+from HolidayTableGenerator import Generate as GenerateHolidayTables
+
 # ----------------------------------------------------------------------
 _script_fullpath                            = CommonEnvironment.ThisFullpath()
 _script_dir, _script_name                   = os.path.split(_script_fullpath)
@@ -69,6 +71,10 @@ def EntryPoint(
             with open(jsonPath, 'w') as f:
                 json.dump(out, f)
 
+        # The tables compiled into the DateTimeFeaturizer are based on the JSON
+        # content and must be regenerated along with it.
+        GenerateHolidayTables(output_dir)
+
         return dm.result
 
 # ----------------------------------------------------------------------
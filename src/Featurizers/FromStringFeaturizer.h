@@ -4,6 +4,7 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include "../NumberParsing.h"
 #include "../Traits.h"
 #include "Components/InferenceOnlyFeaturizerImpl.h"
 
@@ -37,12 +38,24 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(FromStringTransformer);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Converts a column of `cItems` strings stored contiguously
+    ///                 in `pBytes`, where item `i` is the range [pOffsets[i], pOffsets[i + 1]).
+    ///                 Numeric values are parsed in place, without creating
+    ///                 temporary strings.
+    ///
+    void execute_batch(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    static void ExecuteBatchImpl(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput, std::true_type /*is_numeric*/);
+    static void ExecuteBatchImpl(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput, std::false_type /*is_numeric*/);
+
 
     // MSVC has problems with the function declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
@@ -91,6 +104,50 @@ FromStringTransformer<T>::FromStringTransformer(Archive &ar) :
     BaseType(ar) {
 }
 
+template <typename T>
+void FromStringTransformer<T>::execute_batch(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput) const {
+    ExecuteBatchImpl(
+        pBytes,
+        pOffsets,
+        cItems,
+        pOutput,
+        std::integral_constant<bool, std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false>()
+    );
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+// static
+void FromStringTransformer<T>::ExecuteBatchImpl(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput, std::true_type /*is_numeric*/) {
+    NumberParsing::ParseBatch(pBytes, pOffsets, cItems, pOutput);
+}
+
+template <typename T>
+// static
+void FromStringTransformer<T>::ExecuteBatchImpl(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput, std::false_type /*is_numeric*/) {
+    if(cItems == 0)
+        return;
+
+    if(pOffsets == nullptr)
+        throw std::invalid_argument("pOffsets");
+    if(pBytes == nullptr && pOffsets[cItems] != pOffsets[0])
+        throw std::invalid_argument("pBytes");
+    if(pOutput == nullptr)
+        throw std::invalid_argument("pOutput");
+
+    std::string                             value;
+
+    for(size_t i = 0; i < cItems; ++i) {
+        if(pOffsets[i + 1] < pOffsets[i])
+            throw std::invalid_argument("pOffsets");
+
+        value.assign(pBytes + pOffsets[i], pOffsets[i + 1] - pOffsets[i]);
+        pOutput[i] = Traits<T>::FromString(value);
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  FromStringEstimator
@@ -7,6 +7,7 @@
 #include "Structs.h"
 #include "../Traits.h"
 #include "Components/InferenceOnlyFeaturizerImpl.h"
+#include "Components/MurmurHash3Batch.h"
 #include "../3rdParty/MurmurHash3.h"
 
 namespace Microsoft {
@@ -63,6 +64,15 @@ public:
 
     void save(Archive & ar) const override;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cItems` inputs, writing the index of the value
+    ///                 set in each encoded vector (which has `numCols` elements)
+    ///                 to `pIndexes`. Fixed-size inputs are hashed several values
+    ///                 at a time.
+    ///
+    void execute_batch(Type const *pInput, size_t cItems, std::uint64_t *pIndexes) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -72,11 +82,23 @@ private:
     std::uint32_t const                        _hashingSeedVal;
     std::uint32_t const                        _numCols;
 
+    // When _numCols is a power of 2, the column is calculated with a mask rather than a modulo
+    std::uint32_t const                        _mask;
+    bool const                                 _useMask;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    std::uint64_t get_index(std::uint32_t colHashVal) const;
+
+    template <typename U>
+    void execute_batch_impl(U const *pInput, size_t cItems, std::uint64_t *pIndexes, std::true_type /*is_pod*/) const;
+
+    template <typename U>
+    void execute_batch_impl(U const *pInput, size_t cItems, std::uint64_t *pIndexes, std::false_type /*is_pod*/) const;
+
     // MSVC has problems when the function is defined outside of the declaration
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
 
@@ -86,7 +108,7 @@ private:
             SingleValueSparseVectorEncoding<std::uint8_t>(
                 _numCols,
                 1,
-                static_cast<std::uint64_t>(colHashVal % _numCols)
+                get_index(colHashVal)
             )
         );
     }
@@ -163,7 +185,9 @@ HashOneHotVectorizerTransformer<T>::HashOneHotVectorizerTransformer(std::uint32_
         if (numCols <= 0)
             throw std::runtime_error("Invalid numCols");
         return numCols;
-    }())){
+    }())),
+    _mask(_numCols - 1),
+    _useMask((_numCols & (_numCols - 1)) == 0) {
 }
 
 template <typename T>
@@ -204,6 +228,62 @@ void HashOneHotVectorizerTransformer<T>::save(Archive & ar) const {
     Traits<std::uint32_t>::serialize(ar, _numCols);
 }
 
+template <typename T>
+void HashOneHotVectorizerTransformer<T>::execute_batch(Type const *pInput, size_t cItems, std::uint64_t *pIndexes) const {
+    if(pInput == nullptr && cItems != 0)
+        throw std::invalid_argument("pInput");
+    if(pIndexes == nullptr && cItems != 0)
+        throw std::invalid_argument("pIndexes");
+
+    execute_batch_impl(pInput, cItems, pIndexes, std::integral_constant<bool, std::is_pod<Type>::value>());
+}
+
+template <typename T>
+std::uint64_t HashOneHotVectorizerTransformer<T>::get_index(std::uint32_t colHashVal) const {
+    return static_cast<std::uint64_t>(_useMask ? colHashVal & _mask : colHashVal % _numCols);
+}
+
+template <typename T>
+template <typename U>
+void HashOneHotVectorizerTransformer<T>::execute_batch_impl(U const *pInput, size_t cItems, std::uint64_t *pIndexes, std::true_type /*is_pod*/) const {
+    // Hash the values in chunks so that the hashes remain in the cache
+    static constexpr size_t const           ChunkSize = 256;
+
+    std::uint32_t                           hashes[ChunkSize];
+
+    while(cItems) {
+        size_t const                        cChunkItems(std::min(cItems, ChunkSize));
+
+        Components::MurmurHash3_x86_32_Batch(pInput, cChunkItems, _hashingSeedVal, hashes);
+
+        if(_useMask) {
+            for(size_t i = 0; i < cChunkItems; ++i)
+                pIndexes[i] = static_cast<std::uint64_t>(hashes[i] & _mask);
+        }
+        else {
+            for(size_t i = 0; i < cChunkItems; ++i)
+                pIndexes[i] = static_cast<std::uint64_t>(hashes[i] % _numCols);
+        }
+
+        pInput += cChunkItems;
+        pIndexes += cChunkItems;
+        cItems -= cChunkItems;
+    }
+}
+
+template <typename T>
+template <typename U>
+void HashOneHotVectorizerTransformer<T>::execute_batch_impl(U const *pInput, size_t cItems, std::uint64_t *pIndexes, std::false_type /*is_pod*/) const {
+    U const * const                         pEndInput(pInput + cItems);
+
+    while(pInput != pEndInput) {
+        *pIndexes = get_index(MurmurHashHelper(*pInput, _hashingSeedVal));
+
+        ++pInput;
+        ++pIndexes;
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  HashOneHotVectorizerEstimator
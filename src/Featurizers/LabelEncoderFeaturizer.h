@@ -6,6 +6,7 @@
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
 #include "Components/HistogramEstimator.h"
+#include "Components/DenseIndexMap.h"
 #include "Components/IndexMapEstimator.h"
 
 namespace Microsoft {
@@ -26,13 +27,14 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                          = StandardTransformer<InputT, std::uint32_t>;
     using IndexMap                          = typename Components::IndexMapAnnotationData<InputT>::IndexMap;
+    using LabelsType                        = Components::CompactIndexMap<InputT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap const                          Labels;
+    LabelsType const                        Labels;
     bool const                              AllowMissingValues;
 
     // ----------------------------------------------------------------------
@@ -40,7 +42,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    LabelEncoderTransformer(IndexMap map, bool allowMissingValues);
+    LabelEncoderTransformer(LabelsType map, bool allowMissingValues);
     LabelEncoderTransformer(Archive &ar);
 
     ~LabelEncoderTransformer(void) override = default;
@@ -51,7 +53,25 @@ public:
 
     bool operator==(LabelEncoderTransformer const &other) const;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cItems` inputs, writing the results to `pOutput`.
+    ///                 Integral inputs whose trained values are in a dense range
+    ///                 are transformed with a direct-indexed table rather than
+    ///                 hash lookups.
+    ///
+    void execute_batch(InputT const *pInput, size_t cItems, std::uint32_t *pOutput) const;
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint32_t const    NotFoundValue = std::numeric_limits<std::uint32_t>::max();
+
+    Components::DenseIndexMap<InputT> const _denseLabels;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -60,18 +80,10 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        typename IndexMap::const_iterator const         iter(Labels.find(input));
-
-        if(iter == Labels.end()) {
-            if(AllowMissingValues) {
-                callback(0);
-                return;
-            }
+        std::uint32_t                       result;
 
-            throw std::invalid_argument("'input' was not found");
-        }
-
-        callback(iter->second + (AllowMissingValues ? 1 : 0));
+        execute_batch(&input, 1, &result);
+        callback(result);
     }
 };
 
@@ -202,9 +214,10 @@ public:
 // |
 // ----------------------------------------------------------------------
 template <typename InputT>
-LabelEncoderTransformer<InputT>::LabelEncoderTransformer(IndexMap map, bool allowMissingValues) :
+LabelEncoderTransformer<InputT>::LabelEncoderTransformer(LabelsType map, bool allowMissingValues) :
     Labels(std::move(map)),
-    AllowMissingValues(std::move(allowMissingValues)) {
+    AllowMissingValues(std::move(allowMissingValues)),
+    _denseLabels(Labels, AllowMissingValues ? 1 : 0, AllowMissingValues ? 0 : NotFoundValue) {
 }
 
 template <typename InputT>
@@ -219,7 +232,7 @@ LabelEncoderTransformer<InputT>::LabelEncoderTransformer(Archive &ar) :
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMap                        map(Traits<IndexMap>::deserialize(ar));
+            LabelsType                      map(Traits<LabelsType>::deserialize(ar));
             bool                            allowMissingValues(Traits<bool>::deserialize(ar));
 
             return LabelEncoderTransformer(std::move(map), std::move(allowMissingValues));
@@ -244,6 +257,45 @@ bool LabelEncoderTransformer<InputT>::operator==(LabelEncoderTransformer const &
         && AllowMissingValues == other.AllowMissingValues;
 }
 
+template <typename InputT>
+void LabelEncoderTransformer<InputT>::execute_batch(InputT const *pInput, size_t cItems, std::uint32_t *pOutput) const {
+    if(pInput == nullptr && cItems != 0)
+        throw std::invalid_argument("pInput");
+    if(pOutput == nullptr && cItems != 0)
+        throw std::invalid_argument("pOutput");
+
+    if(_denseLabels.is_enabled()) {
+        _denseLabels.lookup(pInput, cItems, pOutput);
+
+        if(AllowMissingValues == false) {
+            for(std::uint32_t const *pValue = pOutput; pValue != pOutput + cItems; ++pValue) {
+                if(*pValue == NotFoundValue)
+                    throw std::invalid_argument("'input' was not found");
+            }
+        }
+
+        return;
+    }
+
+    InputT const * const                    pEndInput(pInput + cItems);
+
+    while(pInput != pEndInput) {
+        std::uint32_t const * const         pIndex(Components::FindIndex(Labels, *pInput));
+
+        if(pIndex == nullptr) {
+            if(AllowMissingValues == false)
+                throw std::invalid_argument("'input' was not found");
+
+            *pOutput = 0;
+        }
+        else
+            *pOutput = *pIndex + (AllowMissingValues ? 1 : 0);
+
+        ++pInput;
+        ++pOutput;
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  LabelEncoderEstimator
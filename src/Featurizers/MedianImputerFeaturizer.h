@@ -95,6 +95,9 @@ struct ShouldInterpolateValues {
 ///  \brief         Creates a `Transformer` that populates null values with the
 ///                 median value encountered during training.
 ///
+///                 See `Components::MedianEstimatorMode` for the memory/accuracy
+///                 tradeoff of `mode` and `rankError`.
+///
 template <
     typename InputT,
     typename TransformedT,
@@ -126,7 +129,12 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex);
+    MedianImputerEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        size_t colIndex,
+        Components::MedianEstimatorMode mode=Components::MedianEstimatorMode::Exact,
+        double rankError=Components::MedianEstimatorDefaultRankError
+    );
     ~MedianImputerEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MedianImputerEstimator);
@@ -186,11 +194,11 @@ void Details::MedianImputerEstimatorImpl<InputT, TransformedT, InterpolateValues
 // |
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT, bool InterpolateValuesV, size_t MaxNumTrainingItemsV>
-MedianImputerEstimator<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>::MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex) :
+MedianImputerEstimator<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>::MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, Components::MedianEstimatorMode mode, double rankError) :
     BaseType(
         "MedianImputerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::MedianEstimator<typename Traits<InputT>::nullable_type, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex, mode, rankError](void) { return Components::MedianEstimator<typename Traits<InputT>::nullable_type, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), true, mode, rankError); },
         [pAllColumnAnnotations, colIndex](void) { return Details::MedianImputerEstimatorImpl<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); }
     ) {
 }
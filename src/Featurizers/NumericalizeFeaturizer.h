@@ -27,13 +27,14 @@ public:
     // ----------------------------------------------------------------------
     using BaseType = StandardTransformer<InputT, std::double_t>;
     using IndexMap = typename Components::IndexMapAnnotationData<InputT>::IndexMap;
+    using LabelsType = Components::CompactIndexMap<InputT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    explicit NumericalizeTransformer (IndexMap map);
+    explicit NumericalizeTransformer (LabelsType map);
     explicit NumericalizeTransformer (Archive &ar);
 
     ~NumericalizeTransformer (void) override = default;
@@ -53,10 +54,10 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const& input, typename BaseType::CallbackFunction const& callback) override {
-        typename IndexMap::const_iterator const         iter(labels_.find(input));
+        std::uint32_t const * const pIndex(Components::FindIndex(labels_, input));
         double result = 0.;
-        if(iter != labels_.end()) {
-            result = iter->second;
+        if(pIndex != nullptr) {
+            result = *pIndex;
         } else {
             result = std::numeric_limits<double>::quiet_NaN();
         }
@@ -64,7 +65,7 @@ private:
     }
 
 private:
-    IndexMap const labels_;
+    LabelsType const labels_;
 };
 
 namespace Details {
@@ -193,7 +194,7 @@ public:
 // ----------------------------------------------------------------------
 
 template<typename InputT>
-inline NumericalizeTransformer<InputT>::NumericalizeTransformer(IndexMap map) :
+inline NumericalizeTransformer<InputT>::NumericalizeTransformer(LabelsType map) :
     labels_(std::move(map)) {
  }
 
@@ -209,7 +210,7 @@ inline NumericalizeTransformer<InputT>::NumericalizeTransformer(Archive & ar) :
             throw std::runtime_error("Unsupported archive version");
 
         // Data
-        return NumericalizeTransformer(Traits<IndexMap>::deserialize(ar));
+        return NumericalizeTransformer(Traits<LabelsType>::deserialize(ar));
         }()
     ) {
 }
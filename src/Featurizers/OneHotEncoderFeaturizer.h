@@ -6,6 +6,7 @@
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
 #include "Components/HistogramEstimator.h"
+#include "Components/DenseIndexMap.h"
 #include "Components/IndexMapEstimator.h"
 #include "Structs.h"
 
@@ -27,13 +28,14 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                          = StandardTransformer<InputT, SingleValueSparseVectorEncoding<std::uint8_t>>;
     using IndexMap                          = typename Components::IndexMapAnnotationData<InputT>::IndexMap;
+    using LabelsType                        = Components::CompactIndexMap<InputT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap  const                         Labels;
+    LabelsType const                        Labels;
     bool const                              AllowMissingValues;
 
     // ----------------------------------------------------------------------
@@ -41,7 +43,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    OneHotEncoderTransformer(IndexMap map, bool allowMissingValues);
+    OneHotEncoderTransformer(LabelsType map, bool allowMissingValues);
     OneHotEncoderTransformer(Archive &ar);
 
     ~OneHotEncoderTransformer(void) override = default;
@@ -52,7 +54,34 @@ public:
 
     void save(Archive &ar) const override;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_num_elements
+    ///  \brief         Returns the number of elements in each encoded vector.
+    ///
+    std::uint64_t get_num_elements(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cItems` inputs, writing the index of the value
+    ///                 set in each encoded vector to `pIndexes`. Integral inputs
+    ///                 whose trained values are in a dense range are transformed
+    ///                 with a direct-indexed table rather than hash lookups.
+    ///
+    void execute_batch(InputT const *pInput, size_t cItems, std::uint64_t *pIndexes) const;
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint32_t const    NotFoundValue = std::numeric_limits<std::uint32_t>::max();
+
+    // When missing values are allowed, the total size is increased by 1 and the 0th
+    // element in the vector represents missing values.
+    std::uint64_t const                     _numElements;
+    Components::DenseIndexMap<InputT> const _denseLabels;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -61,24 +90,10 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        // when missing values are allowed, the total size is increased by 1 and the 0th element in the vector represent missing values
-        std::uint64_t const                 offset(AllowMissingValues ? 1 : 0);
-
-        // Create the encoding value
         std::uint64_t                       encodingIndex;
 
-        typename IndexMap::const_iterator const         label_iter(Labels.find(input));
-
-        if(label_iter == Labels.end()) {
-            if(AllowMissingValues == false)
-                throw std::invalid_argument("'input' was not found");
-
-            encodingIndex = 0;
-        }
-        else
-            encodingIndex = static_cast<std::uint64_t>(label_iter->second + offset);
-
-        callback(SingleValueSparseVectorEncoding<std::uint8_t>(Labels.size() + offset, 1, encodingIndex));
+        execute_batch(&input, 1, &encodingIndex);
+        callback(SingleValueSparseVectorEncoding<std::uint8_t>(_numElements, 1, encodingIndex));
     }
 };
 
@@ -210,10 +225,10 @@ public:
 // |
 // ----------------------------------------------------------------------
 template <typename InputT>
-OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(IndexMap map, bool allowMissingValues) :
+OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(LabelsType map, bool allowMissingValues) :
     Labels(
         std::move(
-            [&map](void) ->  IndexMap & {
+            [&map](void) ->  LabelsType & {
                 if (map.size() == 0) {
                     throw std::invalid_argument("Index map is empty!");
                 }
@@ -221,7 +236,9 @@ OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(IndexMap map, bool al
             }()
         )
     ),
-    AllowMissingValues(std::move(allowMissingValues)) {
+    AllowMissingValues(std::move(allowMissingValues)),
+    _numElements(Labels.size() + (AllowMissingValues ? 1 : 0)),
+    _denseLabels(Labels, AllowMissingValues ? 1 : 0, AllowMissingValues ? 0 : NotFoundValue) {
 }
 
 template <typename InputT>
@@ -236,7 +253,7 @@ OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(Archive &ar) :
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMap                        map(Traits<IndexMap>::deserialize(ar));
+            LabelsType                      map(Traits<LabelsType>::deserialize(ar));
             bool                            allowMissingValues(Traits<bool>::deserialize(ar));
 
             return OneHotEncoderTransformer(std::move(map), std::move(allowMissingValues));
@@ -261,6 +278,50 @@ bool OneHotEncoderTransformer<InputT>::operator==(OneHotEncoderTransformer const
         && AllowMissingValues == other.AllowMissingValues;
 }
 
+template <typename InputT>
+std::uint64_t OneHotEncoderTransformer<InputT>::get_num_elements(void) const {
+    return _numElements;
+}
+
+template <typename InputT>
+void OneHotEncoderTransformer<InputT>::execute_batch(InputT const *pInput, size_t cItems, std::uint64_t *pIndexes) const {
+    if(pInput == nullptr && cItems != 0)
+        throw std::invalid_argument("pInput");
+    if(pIndexes == nullptr && cItems != 0)
+        throw std::invalid_argument("pIndexes");
+
+    if(_denseLabels.is_enabled()) {
+        _denseLabels.lookup(pInput, cItems, pIndexes);
+
+        if(AllowMissingValues == false) {
+            for(std::uint64_t const *pIndex = pIndexes; pIndex != pIndexes + cItems; ++pIndex) {
+                if(*pIndex == NotFoundValue)
+                    throw std::invalid_argument("'input' was not found");
+            }
+        }
+
+        return;
+    }
+
+    InputT const * const                    pEndInput(pInput + cItems);
+
+    while(pInput != pEndInput) {
+        std::uint32_t const * const         pIndex(Components::FindIndex(Labels, *pInput));
+
+        if(pIndex == nullptr) {
+            if(AllowMissingValues == false)
+                throw std::invalid_argument("'input' was not found");
+
+            *pIndexes = 0;
+        }
+        else
+            *pIndexes = static_cast<std::uint64_t>(*pIndex) + (AllowMissingValues ? 1 : 0);
+
+        ++pInput;
+        ++pIndexes;
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  OneHotEncoderEstimator
@@ -6,6 +6,7 @@
 
 #include "Components/MedianEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "Components/QuantileEstimator.h"
 #include "Components/StatisticalMetricsEstimator.h"
 
 namespace Microsoft {
@@ -64,13 +65,19 @@ namespace Details {
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         RobustScalerEstimatorImpl
-///  \brief         This class retrieves a RobustScalerNormAnnotation and computes
-///                 the scale.
+///  \brief         This class retrieves the annotations computed during training and
+///                 computes the median and scale.
+///
+///                 By default, the median is exact and the scale is the range of the
+///                 data multiplied by the size of the quantile range. When
+///                 `ScaleFromQuantilesV` is true, both the median and the scale (the
+///                 distance between the quantiles) are read from a QuantileEstimator.
 ///
 template <
     typename InputT,
     typename TransformedT,
-    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()
+    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max(),
+    bool ScaleFromQuantilesV=false
 >
 class RobustScalerEstimatorImpl : public TransformerEstimator<InputT, TransformedT> {
 public:
@@ -92,6 +99,11 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(RobustScalerEstimatorImpl);
 
+    /// Returns the quantiles that must be computed during training so that all
+    /// of the values needed by the transformer are produced in a single pass.
+    /// Invalid ranges are ignored here and reported by the constructor.
+    static std::vector<double> GetQuantiles(bool withCentering, float qRangeMin, float qRangeMax);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -108,12 +120,24 @@ private:
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    static double GetQuantile(float percentile);
+
     bool begin_training_impl(void) override;
     FitResult fit_impl(typename BaseType::InputType const *, size_t) override;
     void complete_training_impl(void) override;
 
     // MSVC runs into problems when separating the definition for this method
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
+        TransformedT                        median(static_cast<TransformedT>(0.0));
+        TransformedT                        scale(static_cast<TransformedT>(1.0));
+
+        get_median_and_scale(median, scale, std::integral_constant<bool, ScaleFromQuantilesV>());
+
+        return typename BaseType::TransformerUniquePtr(new RobustScalerTransformer<InputT, TransformedT>(std::move(median), std::move(scale)));
+    }
+
+    // MSVC runs into problems when separating the definition for this method
+    void get_median_and_scale(TransformedT &median, TransformedT &scale, std::false_type /*ScaleFromQuantilesV*/) const {
         // ----------------------------------------------------------------------
         using MedianEstimator                           = Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>;
         using MedianAnnotationData                      = Components::MedianAnnotationData<TransformedT>;
@@ -122,16 +146,12 @@ private:
         using StatisticalMetricsAnnoationData           = typename StatisticalMetricsEstimator::AnnotationData;
         // ----------------------------------------------------------------------
 
-        TransformedT                        median(static_cast<TransformedT>(0.0));
-
         if(_withCentering) {
             MedianAnnotationData const &                medianData(MedianEstimator::get_annotation_data(BaseType::get_column_annotations(), _colIndex, Components::MedianEstimatorName));
 
             median = medianData.Median;
         }
 
-        TransformedT                        scale(static_cast<TransformedT>(1.0));
-
         if(Traits<float>::IsNull(_qRangeMin) == false) {
             float const                     qRangeRatio((_qRangeMax - _qRangeMin) / 100.0f);
 
@@ -150,47 +170,82 @@ private:
 #   pragma clang diagnostic pop
 #endif
         }
+    }
 
-        return typename BaseType::TransformerUniquePtr(new RobustScalerTransformer<InputT, TransformedT>(std::move(median), std::move(scale)));
+    // MSVC runs into problems when separating the definition for this method
+    void get_median_and_scale(TransformedT &median, TransformedT &scale, std::true_type /*ScaleFromQuantilesV*/) const {
+        // ----------------------------------------------------------------------
+        using QuantileEstimator                         = Components::QuantileEstimator<InputT, MaxNumTrainingItemsV>;
+        // ----------------------------------------------------------------------
+
+        Components::QuantileAnnotationData const &      quantileData(QuantileEstimator::get_annotation_data(BaseType::get_column_annotations(), _colIndex, Components::QuantileEstimatorName));
+
+        if(_withCentering)
+            median = static_cast<TransformedT>(quantileData.get_value(0.5));
+
+        if(Traits<float>::IsNull(_qRangeMin) == false) {
+            assert(_qRangeMin <= _qRangeMax);
+
+            scale = static_cast<TransformedT>(quantileData.get_value(GetQuantile(_qRangeMax)) - quantileData.get_value(GetQuantile(_qRangeMin)));
+        }
     }
 };
 
 } // namespace Details
 
 
+namespace Details {
+
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+using RobustScalerPipelineExecutionEstimatorImpl =
+    typename std::conditional<
+        ScaleFromQuantilesV,
+        Components::PipelineExecutionEstimatorImpl<
+            Components::QuantileEstimator<InputT, MaxNumTrainingItemsV>,
+            RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>
+        >,
+        Components::PipelineExecutionEstimatorImpl<
+            Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>,
+            Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>,
+            RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>
+        >
+    >::type;
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         RobustScalerEstimator
-///  \brief         This class 'chains' RobustScalerNormEstimator and RobustScalerEstimator.
+///  \brief         By default, this class 'chains' an exact MedianEstimator, a
+///                 StatisticalMetricsEstimator, and RobustScalerEstimatorImpl.
+///
+///                 When `ScaleFromQuantilesV` is true, a QuantileEstimator computes
+///                 the median and the quantile range in a single pass instead. The
+///                 values are exact until the sketch begins compacting values (see
+///                 QuantileSketch) and are computed as doubles, so integers that
+///                 can't be represented as doubles lose precision.
 ///
 template <
     typename InputT,
     typename TransformedT,
-    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()
+    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max(),
+    bool ScaleFromQuantilesV=false
 >
-class RobustScalerEstimator :
-    public Components::PipelineExecutionEstimatorImpl<
-        Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>,
-        Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>,
-        Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>
-    > {
+class RobustScalerEstimator : public Details::RobustScalerPipelineExecutionEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV> {
 public:
     // ----------------------------------------------------------------------
     // |
     // |  Public Types
     // |
     // ----------------------------------------------------------------------
-    using BaseType = Components::PipelineExecutionEstimatorImpl<
-        Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>,
-        Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>,
-        Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>
-    >;
+    using BaseType                          = Details::RobustScalerPipelineExecutionEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>;
+    using EstimatorImplType                 = Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    static RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV> CreateWithDefaultScaling(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool with_centering);
+    static RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV> CreateWithDefaultScaling(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool with_centering);
 
     // Note that the signature with distinct values for qRangeMin and qRangeMax is required
     // for compatibility with the generated C interfaces (which doesn't yet support tuples).
@@ -205,6 +260,15 @@ public:
     ~RobustScalerEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(RobustScalerEstimator);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    RobustScalerEstimator(std::false_type /*ScaleFromQuantilesV*/, AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax);
+    RobustScalerEstimator(std::true_type /*ScaleFromQuantilesV*/, AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax);
 };
 
 // ----------------------------------------------------------------------
@@ -307,8 +371,8 @@ namespace {
 
 } // anonymous namespace
 
-template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>::RobustScalerEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::RobustScalerEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
     BaseType("RobustScalerEstimatorImpl", std::move(pAllColumnAnnotations)),
     _colIndex(
         std::move(
@@ -365,18 +429,44 @@ Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>::
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-bool Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>::begin_training_impl(void) /*override*/ {
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+/*static*/ std::vector<double> Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::GetQuantiles(bool withCentering, float qRangeMin, float qRangeMax) {
+    std::vector<double>                     result;
+
+    if(withCentering)
+        result.emplace_back(0.5);
+
+    if(
+        FloatTraits::IsNull(qRangeMin) == false
+        && FloatTraits::IsNull(qRangeMax) == false
+        && qRangeMin >= 0.0f
+        && qRangeMin <= qRangeMax
+        && qRangeMax <= 100.0f
+    ) {
+        result.emplace_back(GetQuantile(qRangeMin));
+        result.emplace_back(GetQuantile(qRangeMax));
+    }
+
+    return result;
+}
+
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+/*static*/ double Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::GetQuantile(float percentile) {
+    return static_cast<double>(percentile) / 100.0;
+}
+
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+bool Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::begin_training_impl(void) /*override*/ {
     return false;
 }
 
-template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-FitResult Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>::fit_impl(typename BaseType::InputType const *, size_t) /*override*/ {
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+FitResult Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::fit_impl(typename BaseType::InputType const *, size_t) /*override*/ {
     throw std::runtime_error("This should not be called");
 }
 
-template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-void Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+void Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::complete_training_impl(void) /*override*/ {
 }
 
 // ----------------------------------------------------------------------
@@ -384,20 +474,35 @@ void Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItem
 // |  RobustScalerEstimator
 // |
 // ----------------------------------------------------------------------
-template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV>::RobustScalerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::RobustScalerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
+    RobustScalerEstimator(std::integral_constant<bool, ScaleFromQuantilesV>(), std::move(pAllColumnAnnotations), std::move(colIndex), std::move(withCentering), std::move(qRangeMin), std::move(qRangeMax)) {
+}
+
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV> RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::CreateWithDefaultScaling(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering) {
+    return RobustScalerEstimator(std::move(pAllColumnAnnotations), std::move(colIndex), withCentering, 25.0f, 75.0f);
+}
+
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::RobustScalerEstimator(std::false_type, AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
     BaseType(
         "RobustScalerEstimator",
         pAllColumnAnnotations,
         [pAllColumnAnnotations, colIndex](void) { return Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
         [pAllColumnAnnotations, colIndex](void) { return Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
-        [pAllColumnAnnotations, colIndex, &withCentering, &qRangeMin, &qRangeMax](void) { return Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), std::move(withCentering), std::move(qRangeMin), std::move(qRangeMax)); }
+        [pAllColumnAnnotations, colIndex, &withCentering, &qRangeMin, &qRangeMax](void) { return EstimatorImplType(std::move(pAllColumnAnnotations), std::move(colIndex), std::move(withCentering), std::move(qRangeMin), std::move(qRangeMax)); }
     ) {
 }
 
-template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV> RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV>::CreateWithDefaultScaling(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering) {
-    return RobustScalerEstimator(std::move(pAllColumnAnnotations), std::move(colIndex), withCentering, 25.0f, 75.0f);
+template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV, bool ScaleFromQuantilesV>
+RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV, ScaleFromQuantilesV>::RobustScalerEstimator(std::true_type, AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
+    BaseType(
+        "RobustScalerEstimator",
+        pAllColumnAnnotations,
+        [pAllColumnAnnotations, colIndex, &withCentering, &qRangeMin, &qRangeMax](void) { return Components::QuantileEstimator<InputT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), true, EstimatorImplType::GetQuantiles(withCentering, qRangeMin, qRangeMax)); },
+        [pAllColumnAnnotations, colIndex, &withCentering, &qRangeMin, &qRangeMax](void) { return EstimatorImplType(std::move(pAllColumnAnnotations), std::move(colIndex), std::move(withCentering), std::move(qRangeMin), std::move(qRangeMax)); }
+    ) {
 }
 
 } // namespace Featurizers
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../Featurizer.h"
+#include "../NumberFormatting.h"
 #include "../Traits.h"
 
 namespace Microsoft {
@@ -42,6 +43,17 @@ public:
 
     void save(Archive &ar) const override;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Converts `cItems` values, appending the strings contiguously
+    ///                 to `buffer`; the string for item `i` is the range
+    ///                 [offsets[i], offsets[i + 1]). Both `buffer` and `offsets` are
+    ///                 cleared before they are populated, so their capacity can be
+    ///                 reused across calls. Integers and floating point values are
+    ///                 written directly into `buffer` without creating temporary strings.
+    ///
+    void execute_batch(T const *pInput, size_t cItems, std::string &buffer, std::vector<size_t> &offsets) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -50,6 +62,21 @@ private:
     // ----------------------------------------------------------------------
     using Function                          = std::function<std::string (T const &)>;
 
+    using IntegerTag                        = std::integral_constant<int, 0>;
+    using FloatingPointTag                  = std::integral_constant<int, 1>;
+    using OtherTag                          = std::integral_constant<int, 2>;
+
+    using FormatTag =
+        typename std::conditional<
+            std::is_integral<T>::value && std::is_same<T, bool>::value == false,
+            IntegerTag,
+            typename std::conditional<
+                std::is_floating_point<T>::value,
+                FloatingPointTag,
+                OtherTag
+            >::type
+        >::type;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
@@ -69,6 +96,10 @@ private:
         callback(_impl(input));
     }
 
+    void Append(T const &value, std::string &buffer, IntegerTag) const;
+    void Append(T const &value, std::string &buffer, FloatingPointTag) const;
+    void Append(T const &value, std::string &buffer, OtherTag) const;
+
     static std::string ToString(T const &value);
     static std::string ToStringWithEmptyStringsForNullValues(T const &value);
     static std::string ToStringWithEmptyStringsForNullValuesImpl(T const &value, std::true_type);
@@ -188,9 +219,56 @@ void StringTransformer<T>::save(Archive &ar) const /*override*/ {
     Traits<bool>::serialize(ar, _useEmptyStringsForNullValues);
 }
 
+template <typename T>
+void StringTransformer<T>::execute_batch(T const *pInput, size_t cItems, std::string &buffer, std::vector<size_t> &offsets) const {
+    if(pInput == nullptr && cItems != 0)
+        throw std::invalid_argument("pInput");
+
+    buffer.clear();
+
+    offsets.clear();
+    offsets.reserve(cItems + 1);
+    offsets.push_back(0);
+
+    T const * const                         pEnd(pInput + cItems);
+
+    while(pInput != pEnd) {
+        Append(*pInput, buffer, FormatTag());
+        offsets.push_back(buffer.size());
+
+        ++pInput;
+    }
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+template <typename T>
+void StringTransformer<T>::Append(T const &value, std::string &buffer, IntegerTag) const {
+    char                                    chars[NumberFormatting::MaxIntegerChars];
+
+    buffer.append(chars, NumberFormatting::FormatInteger(value, chars));
+}
+
+template <typename T>
+void StringTransformer<T>::Append(T const &value, std::string &buffer, FloatingPointTag) const {
+    if(Traits<T>::IsNull(value)) {
+        if(_useEmptyStringsForNullValues == false)
+            buffer.append("NaN", 3);
+
+        return;
+    }
+
+    char                                    chars[NumberFormatting::MaxFixedChars];
+
+    buffer.append(chars, NumberFormatting::FormatFixed(value, chars));
+}
+
+template <typename T>
+void StringTransformer<T>::Append(T const &value, std::string &buffer, OtherTag) const {
+    buffer += _impl(value);
+}
+
 template <typename T>
 // static
 std::string StringTransformer<T>::ToString(T const &value) {
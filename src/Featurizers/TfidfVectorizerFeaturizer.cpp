@@ -15,8 +15,8 @@ namespace Featurizers {
 // |  TfidfVectorizerTransformer
 // |
 // ----------------------------------------------------------------------
-TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
-                                                       IndexMap docuFreq,
+TfidfVectorizerTransformer::TfidfVectorizerTransformer(CompactIndexMap labels,
+                                                       CompactIndexMap docuFreq,
                                                        std::uint32_t totalNumDocus,
                                                        NormMethod norm,
                                                        TfidfPolicy tfidfParameters,
@@ -27,7 +27,7 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
                                                        std::uint32_t ngramRangeMax) :
     _labels(
         std::move(
-            [&labels](void) ->  IndexMap & {
+            [&labels](void) ->  CompactIndexMap & {
                 if (labels.size() == 0) {
                     throw std::invalid_argument("Index map is empty!");
                 }
@@ -37,7 +37,7 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
     ),
     _documentFreq(
         std::move(
-            [&docuFreq](void) ->  IndexMap & {
+            [&docuFreq](void) ->  CompactIndexMap & {
                 if (docuFreq.size() == 0) {
                     throw std::invalid_argument("DocumentFrequency map is empty!");
                 }
@@ -67,8 +67,8 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMap                       labels(Traits<IndexMap>::deserialize(ar));
-            FrequencyMap                   docuFreq(Traits<FrequencyMap>::deserialize(ar));
+            CompactIndexMap                labels(Traits<CompactIndexMap>::deserialize(ar));
+            CompactIndexMap                docuFreq(Traits<CompactIndexMap>::deserialize(ar));
             std::uint32_t                  totalNumDocus(Traits<std::uint32_t >::deserialize(ar));
             NormMethod                     norm(static_cast<NormMethod>(Traits<std::underlying_type<NormMethod>::type>::deserialize(ar)));
             TfidfPolicy                    tfidfParameters(static_cast<TfidfPolicy>(Traits<std::underlying_type<TfidfPolicy>::type>::deserialize(ar)));
@@ -129,31 +129,19 @@ bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &ot
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    //termfrequency for specific document
-    MapWithIterRange documentTermFrequency;
-
-    std::string processedInput = Components::DocumentDecorator(input, _lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax);
-
-    _parseFunc(
-        processedInput,
-        [&documentTermFrequency] (std::string::const_iterator iterStart, std::string::const_iterator iterEnd) {
-            MapWithIterRange::iterator docuTermFreqIter(documentTermFrequency.find(std::make_tuple(iterStart, iterEnd)));
-            if (docuTermFreqIter != documentTermFrequency.end()) {
-                ++docuTermFreqIter->second;
-            } else {
-                documentTermFrequency.insert(std::make_pair(std::make_tuple(iterStart, iterEnd), 1));
-            }
-        }
-    );
+    _arena.decorate_and_parse(input, _parseFunc, _lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax);
 
     std::float_t normVal = 0.0f;
-    std::vector<std::tuple<std::uint32_t, std::float_t>> results;
-    for (auto const & wordIteratorPair : documentTermFrequency) {
-        std::string const word(std::string(std::get<0>(wordIteratorPair.first), std::get<1>(wordIteratorPair.first)));
 
-        IndexMap::const_iterator const      labelIter(_labels.find(word));
+    //results are temporarily stored in the arena for future normalization
+    std::vector<std::tuple<std::uint32_t, std::float_t>> & results(_arena.Results);
+
+    _arena.enumerate_unique_terms(
+        [this, &normVal, &results](std::string const &word, std::uint32_t numAppearances) {
+            std::uint32_t const * const         pLabel(_labels.find(word));
 
-        if (labelIter != _labels.end()) {
+            if (pLabel == nullptr)
+                return;
 
             double tf;
             double idf;
@@ -167,9 +155,9 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
             if ((_tfidfParameters & TfidfPolicy::Binary) == TfidfPolicy::Binary) {
                 tf = 1.0;
             } else if (!((_tfidfParameters & TfidfPolicy::SublinearTf) == TfidfPolicy::SublinearTf)) {
-                tf = wordIteratorPair.second;
+                tf = numAppearances;
             } else {
-                tf = 1.0 + std::log(wordIteratorPair.second);
+                tf = 1.0 + std::log(numAppearances);
             }
 
             //calculate idf(inverse document frequency) which measures how important a term is. While computing TF,
@@ -197,10 +185,10 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
                 normVal += tfidf * tfidf;
             }
 
-            //temperarily put output in a vector for future normalization
-            results.emplace_back(std::make_tuple(labelIter->second, tfidf));
+            results.emplace_back(*pLabel, tfidf);
         }
-    }
+    );
+
     //normVal will never be 0 as long as results is not empty
     assert(normVal > 0.0f);
 
@@ -208,17 +196,22 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
     if (_norm == NormMethod::L2)
         normVal = sqrt(normVal);
 
+    // SparseVectorEncoding requires ValueEncoding to be in order; sorting the
+    // scratch results means that the output vector is the only allocation made
+    // for this document.
+    std::sort(results.begin(), results.end(),
+        [](std::tuple<std::uint32_t, std::float_t> const &a, std::tuple<std::uint32_t, std::float_t> const &b) {
+            return std::get<0>(a) < std::get<0>(b);
+        }
+    );
+
     std::vector<SparseVectorEncoding<std::float_t>::ValueEncoding> sparseVector;
 
-    for (auto & result : results) {
-        sparseVector.emplace_back(SparseVectorEncoding<std::float_t>::ValueEncoding(std::get<1>(result) / normVal, std::get<0>(result)));
-    }
+    sparseVector.reserve(results.size());
 
-    std::sort(sparseVector.begin(), sparseVector.end(),
-        [](SparseVectorEncoding<std::float_t>::ValueEncoding const &a, SparseVectorEncoding<std::float_t>::ValueEncoding const &b) {
-            return a.Index < b.Index;
-        }
-    );
+    for (auto const & result : results) {
+        sparseVector.emplace_back(std::get<1>(result) / normVal, std::get<0>(result));
+    }
 
     callback(SparseVectorEncoding<std::float_t>(_labels.size(), std::move(sparseVector)));
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "Components/CompactStringIndexMap.h"
 #include "Components/DocumentStatisticsEstimator.h"
 #include "Structs.h"
 #include "../Traits.h"
@@ -47,6 +48,7 @@ public:
     using BaseType                           = StandardTransformer<std::string, SparseVectorEncoding<std::float_t>>;
     using IndexMap                           = std::unordered_map<std::string, std::uint32_t>;
     using FrequencyMap                       = IndexMap;
+    using CompactIndexMap                    = Components::CompactStringIndexMap;
     using IterRangeType                      = std::tuple<std::string::const_iterator, std::string::const_iterator>;
     using MapWithIterRange                   = std::map<IterRangeType, std::uint32_t, Components::IterRangeComp>;
     using AnalyzerMethod                     = Components::AnalyzerMethod;
@@ -64,8 +66,8 @@ public:
     // |
     // ----------------------------------------------------------------------
     explicit TfidfVectorizerTransformer(
-        IndexMap labels,
-        FrequencyMap docuFreq,
+        CompactIndexMap labels,
+        CompactIndexMap docuFreq,
         std::uint32_t totalNumDocus,
         NormMethod norm,
         TfidfPolicy tfidfParameters,
@@ -101,8 +103,8 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap const                          _labels;
-    FrequencyMap const                      _documentFreq;
+    CompactIndexMap const                   _labels;
+    CompactIndexMap const                   _documentFreq;
     std::uint32_t const                     _totalNumsDocuments;
     NormMethod const                        _norm;
     TfidfPolicy const                       _tfidfParameters;
@@ -116,6 +118,9 @@ private:
 
     ParseFunctionType const                 _parseFunc;
 
+    // Scratch memory reused across calls to `execute_impl`
+    Components::DocumentScratchArena<std::float_t>  _arena;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
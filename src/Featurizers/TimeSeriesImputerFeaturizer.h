@@ -38,7 +38,15 @@ public:
         Components::TimeSeriesImputerEstimator
     >;
 
-    TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes, bool suppresserror = false, Components::TimeSeriesImputeStrategy tsImputeStrategy= Components::TimeSeriesImputeStrategy::Forward);
+    TimeSeriesImputerEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        std::vector<TypeId> colsToImputeDataTypes,
+        bool suppresserror = false,
+        Components::TimeSeriesImputeStrategy tsImputeStrategy= Components::TimeSeriesImputeStrategy::Forward,
+        std::uint32_t maxLookahead=std::numeric_limits<std::uint32_t>::max(),
+        Components::TimeSeriesLookaheadPolicy lookaheadPolicy=Components::TimeSeriesLookaheadPolicy::EmitAsNull,
+        std::uint32_t numTrainingThreads=1
+    );
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesImputerEstimator);
 };
@@ -52,12 +60,12 @@ public:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, bool suppresserror, Components::TimeSeriesImputeStrategy tsImputeStrategy) :
+inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, bool suppresserror, Components::TimeSeriesImputeStrategy tsImputeStrategy, std::uint32_t maxLookahead, Components::TimeSeriesLookaheadPolicy lookaheadPolicy, std::uint32_t numTrainingThreads) :
     BaseType("TimeSeriesImputerEstimator",
         pAllColumnAnnotations,
-        [&pAllColumnAnnotations](void) { return Components::TimeSeriesFrequencyEstimator(pAllColumnAnnotations); },
-        [&pAllColumnAnnotations,&colsToImputeDataTypes](void) { return Components::TimeSeriesMedianEstimator(pAllColumnAnnotations,colsToImputeDataTypes); },
-        [&pAllColumnAnnotations,&colsToImputeDataTypes,&tsImputeStrategy,&suppresserror](void) { return Components::TimeSeriesImputerEstimator(pAllColumnAnnotations,colsToImputeDataTypes,tsImputeStrategy,suppresserror); }
+        [&pAllColumnAnnotations,&numTrainingThreads](void) { return Components::TimeSeriesFrequencyEstimator(pAllColumnAnnotations,numTrainingThreads); },
+        [&pAllColumnAnnotations,&colsToImputeDataTypes,&numTrainingThreads](void) { return Components::TimeSeriesMedianEstimator(pAllColumnAnnotations,colsToImputeDataTypes,Components::QuantileSketch::DefaultK,numTrainingThreads); },
+        [&pAllColumnAnnotations,&colsToImputeDataTypes,&tsImputeStrategy,&suppresserror,&maxLookahead,&lookaheadPolicy](void) { return Components::TimeSeriesImputerEstimator(pAllColumnAnnotations,colsToImputeDataTypes,tsImputeStrategy,suppresserror,maxLookahead,lookaheadPolicy); }
     ) {
 }
 
@@ -10,6 +10,7 @@
 #include "../CountVectorizerFeaturizer.h"
 #include "../Structs.h"
 #include "../TestHelpers.h"
+#include "../AllocationCountingTestHelpers.h"
 #include "../../Traits.h"
 
 namespace NS = Microsoft::Featurizer;
@@ -397,3 +398,41 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Steady-state allocations") {
+    using TransformerType = NS::Featurizers::CountVectorizerTransformer;
+    using TransformedType = NS::Featurizers::SparseVectorEncoding<std::uint32_t>;
+
+    for(AnalyzerMethod analyzer : { AnalyzerMethod::Word, AnalyzerMethod::Char }) {
+        TransformerType                     transformer(
+            IndexMapType({{"apple", 0}, {"banana", 1}, {"grape", 2}, {"a", 3}, {"p", 4}}),
+            false,
+            true,
+            analyzer,
+            "",
+            1,
+            1
+        );
+
+        std::string const                   longInput("banana GRAPE grape apple apple apple orange");
+        std::string const                   shortInput("apple grape peach");
+        size_t                              numResults(0);
+        TransformerType::CallbackFunction const     callback(
+            [&numResults](TransformedType result) {
+                numResults += result.Values.size();
+            }
+        );
+
+        // The first document warms up the arena
+        transformer.execute(longInput, callback);
+
+        size_t const                        numAllocations(NS::TestHelpers::g_numAllocations);
+
+        transformer.execute(longInput, callback);
+        transformer.execute(shortInput, callback);
+
+        // The only allocation made per document is the vector owned by the result
+        CHECK(NS::TestHelpers::g_numAllocations - numAllocations == 2);
+        CHECK(numResults != 0);
+    }
+}
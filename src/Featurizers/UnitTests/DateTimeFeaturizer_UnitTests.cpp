@@ -229,6 +229,187 @@ TEST_CASE("Holidays - Finland - No Holiday date", "[DateTimeTransformer][DateTim
     CHECK(tp.holidayName == "");
 }
 
+TEST_CASE("Holidays - Embedded tables match data root dir") {
+    // The test is run from the build dir, which contains a copy of the JSON files
+    // in 'Data/DateTimeFeaturizer'.
+    for(std::string const &country : NS::Featurizers::DateTimeEstimator::GetSupportedCountries()) {
+        NS::Featurizers::DateTimeTransformer    embedded(country);
+        NS::Featurizers::DateTimeTransformer    json(country, ".");
+
+        INFO(country);
+        CHECK(embedded == json);
+    }
+
+    NS::Featurizers::DateTimeTransformer    json("Canada", ".");
+
+    CHECK(json.execute(SysClock::from_time_t(157161600)).holidayName == "Christmas Day");
+    CHECK(json.execute(SysClock::from_time_t(157161599)).holidayName == "1 day before Christmas Day");
+    CHECK((NS::Featurizers::DateTimeTransformer("Canada") == NS::Featurizers::DateTimeTransformer("Finland")) == false);
+    CHECK((NS::Featurizers::DateTimeTransformer("Canada") == NS::Featurizers::DateTimeTransformer("")) == false);
+}
+
+TEST_CASE("Holidays - Shared tables") {
+    std::time_t const                       christmas(157161600);
+
+    {
+        NS::Featurizers::DateTimeTransformer    dt1("Canada", ".");
+        NS::Featurizers::DateTimeTransformer    dt2("canada", ".");
+        NS::Featurizers::DateTimeTransformer    dt3("Canada");
+        NS::Featurizers::DateTimeTransformer    dt4("Canada");
+
+        // Transformers for the same country and data root dir share the holiday names
+        CHECK(dt1.execute(SysClock::from_time_t(christmas)).holidayName.data() == dt2.execute(SysClock::from_time_t(christmas)).holidayName.data());
+        CHECK(dt3.execute(SysClock::from_time_t(christmas)).holidayName.data() == dt4.execute(SysClock::from_time_t(christmas)).holidayName.data());
+        CHECK(dt1.execute(SysClock::from_time_t(christmas)).holidayName.data() != dt3.execute(SysClock::from_time_t(christmas)).holidayName.data());
+    }
+
+    // The tables are reloaded once all of the transformers that used them are gone
+    NS::Featurizers::DateTimeTransformer    dt("Canada", ".");
+
+    CHECK(dt.execute(SysClock::from_time_t(christmas)).holidayName == "Christmas Day");
+
+    // Deserialization uses the shared tables as well
+    NS::Archive                             out;
+
+    dt.save(out);
+
+    NS::Archive                             in(out.commit());
+    NS::Featurizers::DateTimeTransformer    other(in, ".");
+
+    CHECK(other.execute(SysClock::from_time_t(christmas)).holidayName.data() == dt.execute(SysClock::from_time_t(christmas)).holidayName.data());
+}
+
+TEST_CASE("execute_batch") {
+    std::vector<std::int64_t> const         inputs{157161600, 157161650, 157161599, -1, 1751241600, 217081625};
+
+    for(std::uint16_t dayCacheSize : {NS::Featurizers::DateTimeTransformer::DefaultDayCacheSize, static_cast<std::uint16_t>(0)}) {
+        NS::Featurizers::DateTimeTransformer    batch("Canada", std::string(), dayCacheSize);
+        NS::Featurizers::DateTimeTransformer    single("Canada");
+
+        std::vector<std::int32_t>           year(inputs.size());
+        std::vector<std::uint8_t>           month(inputs.size());
+        std::vector<std::uint8_t>           hour(inputs.size());
+        std::vector<std::uint8_t>           minute(inputs.size());
+        std::vector<std::uint8_t>           second(inputs.size());
+        std::vector<std::uint16_t>          dayOfYear(inputs.size());
+        std::vector<std::uint8_t>           weekIso(inputs.size());
+        std::vector<std::uint8_t>           monthLabel(inputs.size());
+        std::vector<std::uint8_t>           amPmLabel(inputs.size());
+        std::vector<std::uint8_t>           dayOfWeekLabel(inputs.size());
+        std::vector<std::uint16_t>          holidayName(inputs.size());
+
+        NS::Featurizers::TimePointColumns   columns;
+
+        columns.pYear = year.data();
+        columns.pMonth = month.data();
+        columns.pHour = hour.data();
+        columns.pMinute = minute.data();
+        columns.pSecond = second.data();
+        columns.pDayOfYear = dayOfYear.data();
+        columns.pWeekIso = weekIso.data();
+        columns.pMonthLabel = monthLabel.data();
+        columns.pAmPmLabel = amPmLabel.data();
+        columns.pDayOfWeekLabel = dayOfWeekLabel.data();
+        columns.pHolidayName = holidayName.data();
+
+        batch.execute_batch(inputs.data(), inputs.size(), columns);
+
+        for(size_t index = 0; index < inputs.size(); ++index) {
+            NS::Featurizers::TimePoint      expected(single.execute(SysClock::from_time_t(static_cast<std::time_t>(inputs[index]))));
+
+            CHECK(year[index] == expected.year);
+            CHECK(month[index] == expected.month);
+            CHECK(hour[index] == expected.hour);
+            CHECK(minute[index] == expected.minute);
+            CHECK(second[index] == expected.second);
+            CHECK(dayOfYear[index] == expected.dayOfYear);
+            CHECK(weekIso[index] == expected.weekIso);
+            CHECK(NS::Featurizers::TimePoint::MonthLabels[monthLabel[index]] == expected.monthLabel);
+            CHECK(NS::Featurizers::TimePoint::AmPmLabels[amPmLabel[index]] == expected.amPmLabel);
+            CHECK(NS::Featurizers::TimePoint::WeekDayLabels[dayOfWeekLabel[index]] == expected.dayOfWeekLabel);
+            CHECK(batch.GetHolidayName(holidayName[index]) == expected.holidayName);
+        }
+
+        CHECK(holidayName[0] != 0);
+        CHECK(holidayName[0] == holidayName[1]);
+        CHECK(holidayName[3] == 0);
+    }
+
+    NS::Featurizers::DateTimeTransformer    dt("");
+
+    // Columns that aren't provided are skipped
+    dt.execute_batch(inputs.data(), inputs.size(), NS::Featurizers::TimePointColumns());
+    dt.execute_batch(nullptr, 0, NS::Featurizers::TimePointColumns());
+
+    CHECK_THROWS_WITH(dt.execute_batch(nullptr, 1, NS::Featurizers::TimePointColumns()), "pSecondsSinceEpoch");
+
+    // Seconds that can't be represented as a calendar date
+    std::int64_t const                      outOfRange[] = {0, std::numeric_limits<std::int64_t>::max()};
+
+    CHECK_THROWS_WITH(dt.execute_batch(outOfRange, 2, NS::Featurizers::TimePointColumns()), "secondsSinceEpoch");
+    CHECK(dt.GetHolidayName(0) == "");
+    CHECK_THROWS_WITH(dt.GetHolidayName(1), "holidayId");
+}
+
+TEST_CASE("Labels") {
+    NS::Featurizers::DateTimeTransformer    dt("Canada");
+    NS::Featurizers::TimePoint              tp(dt.execute(SysClock::from_time_t(157161600)));
+
+    // Labels refer to static tables rather than owning copies
+    CHECK(tp.monthLabel.data() == NS::Featurizers::TimePoint::MonthLabels[NS::Featurizers::TimePoint::DECEMBER - 1].data());
+    CHECK(tp.dayOfWeekLabel.data() == NS::Featurizers::TimePoint::WeekDayLabels[NS::Featurizers::TimePoint::WEDNESDAY].data());
+    CHECK(tp.amPmLabel.data() == NS::Featurizers::TimePoint::AmPmLabels[0].data());
+
+    CHECK(tp.monthLabel == std::string("December"));
+    CHECK(tp.monthLabel != "Decembe");
+    CHECK(tp.monthLabel.size() == 8);
+    CHECK(std::string(tp.dayOfWeekLabel.begin(), tp.dayOfWeekLabel.end()) == "Wednesday");
+
+    // Copies can outlive the transformer
+    std::string const                       holidayName(tp.holidayName.str());
+    std::string const                       monthLabel(tp.monthLabel);
+
+    CHECK(holidayName == "Christmas Day");
+    CHECK(monthLabel == "December");
+
+    CHECK(NS::Featurizers::StringView().empty());
+    CHECK(NS::Featurizers::StringView() == "");
+}
+
+TEST_CASE("Day cache") {
+    NS::Featurizers::DateTimeTransformer    cached("Canada", std::string(), 4);
+    NS::Featurizers::DateTimeTransformer    uncached("Canada", std::string(), 0);
+
+    // Times within the same day, on days that collide in the cache, and before the epoch
+    std::vector<std::time_t> const          times{
+        157161600, 157161650, 157161599, 157248000 - 1, 157161600 + 4 * 86400, 157161601,
+        -1, -86400, -86401, -86400 * 4 - 1, 0, 1088035200, 1088035200 + 1000
+    };
+
+    for(std::time_t t : times) {
+        NS::Featurizers::TimePoint          c(cached.execute(SysClock::from_time_t(t)));
+        NS::Featurizers::TimePoint          u(uncached.execute(SysClock::from_time_t(t)));
+
+        CHECK(c.year == u.year);
+        CHECK(c.month == u.month);
+        CHECK(c.day == u.day);
+        CHECK(c.hour == u.hour);
+        CHECK(c.minute == u.minute);
+        CHECK(c.second == u.second);
+        CHECK(c.dayOfWeek == u.dayOfWeek);
+        CHECK(c.dayOfYear == u.dayOfYear);
+        CHECK(c.weekIso == u.weekIso);
+        CHECK(c.yearIso == u.yearIso);
+        CHECK(c.holidayName == u.holidayName);
+    }
+
+    CHECK(cached.execute(SysClock::from_time_t(157161650)).holidayName == "Christmas Day");
+    CHECK(cached.execute(SysClock::from_time_t(157161600 + 4 * 86400)).holidayName == "");
+    CHECK(cached.execute(SysClock::from_time_t(157161601)).holidayName == "Christmas Day");
+
+    CHECK_THROWS_WITH(NS::Featurizers::DateTimeTransformer("", std::string(), 3), "dayCacheSize");
+}
+
 #ifdef _MSC_VER
 // others define system_clock::time_point as nanoseconds (64-bit),
 // which rolls over somewhere around 2260. Still a couple hundred years!
@@ -248,9 +429,8 @@ TEST_CASE("Far Future - 2998 March 2, 14:03:02", "[DateTimeTransformer][DateTime
     CHECK(tp.weekOfMonth == 0);
 }
 
-#else
+#endif
 
-// msvcrt doesn't support negative time_t, so nothing before 1970
 TEST_CASE("Pre-Epoch - 1776 July 4", "[DateTimeTransformer][DateTimeTransformer]")
 {
 
@@ -261,7 +441,23 @@ TEST_CASE("Pre-Epoch - 1776 July 4", "[DateTimeTransformer][DateTimeTransformer]
     CHECK(tp.month == NS::Featurizers::TimePoint::JULY);
     CHECK(tp.day == 4);
 }
-#endif /* _MSVCRT */
+
+TEST_CASE("Pre-Epoch - 1969 Dec 31, 23:59:59", "[DateTimeTransformer][DateTimeTransformer]") {
+    NS::Featurizers::TimePoint tp(SysClock::from_time_t(-1));
+    CHECK(tp.year == 1969);
+    CHECK(tp.month == NS::Featurizers::TimePoint::DECEMBER);
+    CHECK(tp.day == 31);
+    CHECK(tp.hour == 23);
+    CHECK(tp.minute == 59);
+    CHECK(tp.second == 59);
+    CHECK(tp.dayOfWeek == NS::Featurizers::TimePoint::WEDNESDAY);
+    CHECK(tp.dayOfYear == 364);
+    CHECK(tp.dayOfQuarter == 92);
+    CHECK(tp.weekIso == 1);
+    CHECK(tp.yearIso == 1970);
+    CHECK(tp.hour12 == 11);
+    CHECK(tp.amPmLabel == "pm");
+}
 
 TEST_CASE("Serialization") {
     NS::Featurizers::DateTimeTransformer    original("United States");
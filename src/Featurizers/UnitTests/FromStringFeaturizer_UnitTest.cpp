@@ -22,6 +22,58 @@ TEST_CASE("int") {
     CHECK_THROWS(NS::Featurizers::FromStringTransformer<int>().execute("invalid"));
 }
 
+TEST_CASE("Parsing") {
+    CHECK(NS::Featurizers::FromStringTransformer<int>().execute(" 42\r\n") == 42);
+    CHECK(NS::Featurizers::FromStringTransformer<int>().execute("+7") == 7);
+    CHECK_THROWS_WITH(NS::Featurizers::FromStringTransformer<int>().execute("12abc"), "Invalid conversion");
+    CHECK_THROWS_WITH(NS::Featurizers::FromStringTransformer<int>().execute("2147483648"), "Invalid conversion");
+    CHECK_THROWS_WITH(NS::Featurizers::FromStringTransformer<std::uint32_t>().execute("-1"), "Invalid conversion");
+
+    CHECK(NS::Featurizers::FromStringTransformer<double>().execute("1.5e3") == 1500.0);
+    CHECK(NS::Featurizers::FromStringTransformer<double>().execute("-.25") == -0.25);
+    CHECK(std::isnan(NS::Featurizers::FromStringTransformer<double>().execute("NaN")));
+    CHECK_THROWS_WITH(NS::Featurizers::FromStringTransformer<double>().execute("1e999"), "Invalid conversion");
+    CHECK_THROWS_WITH(NS::Featurizers::FromStringTransformer<float>().execute("1,5"), "Invalid conversion");
+}
+
+TEST_CASE("execute_batch") {
+    std::string const                       bytes("10-20 30 invalidTrueFalse");
+
+    {
+        std::vector<size_t> const           offsets{ 0, 2, 5, 9 };
+        std::vector<int>                    output(3);
+
+        NS::Featurizers::FromStringTransformer<int>().execute_batch(bytes.data(), offsets.data(), 3, output.data());
+        CHECK(output == std::vector<int>{ 10, -20, 30 });
+
+        std::vector<size_t> const           invalidOffsets{ 0, 2, 16 };
+
+        CHECK_THROWS_WITH(
+            NS::Featurizers::FromStringTransformer<int>().execute_batch(bytes.data(), invalidOffsets.data(), 2, output.data()),
+            "Invalid conversion"
+        );
+    }
+
+    {
+        std::vector<size_t> const           offsets{ 0, 2, 5, 9 };
+        std::vector<double>                 output(3);
+
+        NS::Featurizers::FromStringTransformer<double>().execute_batch(bytes.data(), offsets.data(), 3, output.data());
+        CHECK(output == std::vector<double>{ 10.0, -20.0, 30.0 });
+    }
+
+    {
+        std::vector<size_t> const           offsets{ 16, 20, 25 };
+        bool                                output[2] = { false, true };
+
+        NS::Featurizers::FromStringTransformer<bool>().execute_batch(bytes.data(), offsets.data(), 2, output);
+        CHECK(output[0] == true);
+        CHECK(output[1] == false);
+    }
+
+    NS::Featurizers::FromStringTransformer<int>().execute_batch(nullptr, nullptr, 0, nullptr);
+}
+
 TEST_CASE("Transformer serialization") {
     NS::Featurizers::FromStringTransformer<int>         original;
     NS::Archive                                         out;
@@ -50,6 +50,55 @@ TEST_CASE("HashOneHotVectorizerTransformer_string") {
     CHECK(label == out);
 }
 
+template <typename T>
+void TestBatch(std::vector<T> const &input, std::uint32_t numCols) {
+    NS::Featurizers::HashOneHotVectorizerTransformer<T>                     transformer(2, numCols);
+    std::vector<std::uint64_t>                                              indexes(input.size());
+
+    transformer.execute_batch(input.data(), input.size(), indexes.data());
+
+    for(size_t i = 0; i < input.size(); ++i) {
+        std::uint32_t                       hash;
+
+        MurmurHash3_x86_32(&input[i], static_cast<int>(sizeof(T)), 2, &hash);
+
+        CHECK(indexes[i] == hash % numCols);
+        CHECK(transformer.execute(input[i]) == Encoding(numCols, 1, indexes[i]));
+    }
+}
+
+template <typename T>
+void TestBatch(void) {
+    std::vector<T>                          input;
+
+    // 37 items exercises both the multi-lane and the single-lane code paths
+    for(int i = 0; i < 37; ++i)
+        input.emplace_back(static_cast<T>(i * 3 - 50));
+
+    TestBatch(input, 100);
+    TestBatch(input, 128);
+    TestBatch(input, 1);
+}
+
+TEST_CASE("execute_batch") {
+    TestBatch<std::int8_t>();
+    TestBatch<std::uint16_t>();
+    TestBatch<std::int32_t>();
+    TestBatch<std::uint64_t>();
+    TestBatch<std::float_t>();
+    TestBatch<std::double_t>();
+
+    NS::Featurizers::HashOneHotVectorizerTransformer<std::string>           transformer(2, 100);
+    std::vector<std::string> const                                          strings({"hello", "", "world"});
+    std::vector<std::uint64_t>                                              indexes(strings.size());
+
+    transformer.execute_batch(strings.data(), strings.size(), indexes.data());
+    CHECK(indexes[0] == 25);
+
+    for(size_t i = 0; i < strings.size(); ++i)
+        CHECK(transformer.execute(strings[i]) == Encoding(100, 1, indexes[i]));
+}
+
 TEST_CASE("Serialization") {
     NS::Featurizers::HashOneHotVectorizerTransformer<std::string>           original(2, 100);
     NS::Archive                                                             out;
@@ -102,6 +102,50 @@ TEST_CASE("not found value, throw mode") {
     );
 }
 
+TEST_CASE("execute_batch") {
+    using TransformerType = NS::Featurizers::LabelEncoderTransformer<std::int16_t>;
+
+    IndexMap<std::int16_t, std::uint32_t>   indexmap({ {-3, 0}, {-1, 1}, {2, 2}, {5, 3} });
+    std::vector<std::int16_t> const         input({5, -3, 2, -1, 2});
+    std::vector<std::int16_t> const         unseen({5, 4, -32768, 32767, -4, 6});
+
+    SECTION("Dense, non-throw mode") {
+        TransformerType                     transformer(indexmap, true);
+        std::vector<std::uint32_t>          output(unseen.size());
+
+        transformer.execute_batch(input.data(), input.size(), output.data());
+        CHECK(std::vector<std::uint32_t>(output.begin(), output.begin() + 5) == std::vector<std::uint32_t>({4, 1, 3, 2, 3}));
+
+        transformer.execute_batch(unseen.data(), unseen.size(), output.data());
+        CHECK(output == std::vector<std::uint32_t>({4, 0, 0, 0, 0, 0}));
+
+        std::uint32_t                       result(0);
+
+        transformer.execute(static_cast<std::int16_t>(-1), [&result](std::uint32_t value) { result = value; });
+        CHECK(result == 2);
+    }
+
+    SECTION("Dense, throw mode") {
+        TransformerType                     transformer(indexmap, false);
+        std::vector<std::uint32_t>          output(input.size());
+
+        transformer.execute_batch(input.data(), input.size(), output.data());
+        CHECK(output == std::vector<std::uint32_t>({3, 0, 2, 1, 2}));
+
+        CHECK_THROWS_WITH(transformer.execute_batch(unseen.data(), unseen.size(), output.data()), "'input' was not found");
+    }
+
+    SECTION("Sparse") {
+        // The range is too large for a direct-indexed table
+        TransformerType                     transformer(IndexMap<std::int16_t, std::uint32_t>({ {-30000, 0}, {30000, 1} }), true);
+        std::vector<std::int16_t> const     sparseInput({30000, 0, -30000});
+        std::vector<std::uint32_t>          output(sparseInput.size());
+
+        transformer.execute_batch(sparseInput.data(), sparseInput.size(), output.data());
+        CHECK(output == std::vector<std::uint32_t>({2, 0, 1}));
+    }
+}
+
 TEST_CASE("Serialization/Deserialization- Numeric") {
     using InputType       = std::uint32_t;
     using TransformedType = std::uint32_t;
@@ -78,6 +78,29 @@ TEST_CASE("int") {
     );
 }
 
+TEST_CASE("int - approximate") {
+    CHECK(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::MedianImputerEstimator<int, float>(NS::CreateTestAnnotationMapsPtr(1), 0, NS::Featurizers::Components::MedianEstimatorMode::Approximate, 0.05),
+            std::vector<nonstd::optional<int>>{
+                10,
+                40,
+                20,
+                nonstd::optional<int>(),
+                30,
+                nonstd::optional<int>()
+            },
+            {
+                nonstd::optional<int>(),
+                1,
+                2,
+                3,
+                nonstd::optional<int>()
+            }
+        ) == std::vector<float>{25.0f, 1.0f, 2.0f, 3.0f, 25.0f}
+    );
+}
+
 TEST_CASE("float") {
     // Odd number of items (no interpolation required)
     CHECK(
@@ -117,6 +117,41 @@ TEST_CASE("unseen values") {
     );
 }
 
+TEST_CASE("execute_batch") {
+    using TransformerType = NS::Featurizers::OneHotEncoderTransformer<std::uint8_t>;
+
+    IndexMap<std::uint8_t> const            indexmap({ {0, 0}, {10, 1}, {255, 2} });
+    std::vector<std::uint8_t> const         input({255, 10, 0, 10});
+    std::vector<std::uint8_t> const         unseen({1, 255, 254});
+
+    SECTION("Non-throw mode") {
+        TransformerType                     transformer(indexmap, true);
+        std::vector<std::uint64_t>          output(input.size());
+
+        CHECK(transformer.get_num_elements() == 4);
+
+        transformer.execute_batch(input.data(), input.size(), output.data());
+        CHECK(output == std::vector<std::uint64_t>({3, 2, 1, 2}));
+
+        output.resize(unseen.size());
+
+        transformer.execute_batch(unseen.data(), unseen.size(), output.data());
+        CHECK(output == std::vector<std::uint64_t>({0, 3, 0}));
+    }
+
+    SECTION("Throw mode") {
+        TransformerType                     transformer(indexmap, false);
+        std::vector<std::uint64_t>          output(input.size());
+
+        CHECK(transformer.get_num_elements() == 3);
+
+        transformer.execute_batch(input.data(), input.size(), output.data());
+        CHECK(output == std::vector<std::uint64_t>({2, 1, 0, 1}));
+
+        CHECK_THROWS_WITH(transformer.execute_batch(unseen.data(), unseen.size(), output.data()), "'input' was not found");
+    }
+}
+
 TEST_CASE("Serialization/Deserialization- Numeric") {
     using InputType       = std::uint32_t;
     using TransformerType = NS::Featurizers::OneHotEncoderTransformer<InputType>;
@@ -260,6 +260,38 @@ TEST_CASE("RobustScalerFeaturizer - input<float_t> - output<float_t/double_t>")
     TestWrapper_Integration_Tests<std::float_t, std::double_t>();
 }
 
+TEST_CASE("RobustScalerFeaturizer - outliers") {
+    // By default, the scale is based on the range of the data, so the outlier affects it
+    CHECK(
+        NS::TestHelpers::FuzzyCheck(
+            NS::TestHelpers::TransformerEstimatorTest(
+                NS::Featurizers::RobustScalerEstimator<std::int32_t, std::double_t>::CreateWithDefaultScaling(NS::CreateTestAnnotationMapsPtr(1), 0, true),
+                NS::TestHelpers::make_vector<std::vector<std::int32_t>>(
+                    NS::TestHelpers::make_vector<std::int32_t>(4, 100, 1),
+                    NS::TestHelpers::make_vector<std::int32_t>(3, 2)
+                ),
+                NS::TestHelpers::make_vector<std::int32_t>(1, 3, 5, 100)
+            ),
+            NS::TestHelpers::make_vector<std::double_t>(-2.0 / 49.5, 0.0, 2.0 / 49.5, 97.0 / 49.5)
+        )
+    );
+
+    // When scaling from quantiles, the scale is based on the interquartile range, so the outlier doesn't affect it
+    CHECK(
+        NS::TestHelpers::FuzzyCheck(
+            NS::TestHelpers::TransformerEstimatorTest(
+                NS::Featurizers::RobustScalerEstimator<std::int32_t, std::double_t, std::numeric_limits<size_t>::max(), true>::CreateWithDefaultScaling(NS::CreateTestAnnotationMapsPtr(1), 0, true),
+                NS::TestHelpers::make_vector<std::vector<std::int32_t>>(
+                    NS::TestHelpers::make_vector<std::int32_t>(4, 100, 1),
+                    NS::TestHelpers::make_vector<std::int32_t>(3, 2)
+                ),
+                NS::TestHelpers::make_vector<std::int32_t>(1, 3, 5, 100)
+            ),
+            NS::TestHelpers::make_vector<std::double_t>(-1.0, 0.0, 1.0, 48.5)
+        )
+    );
+}
+
 TEST_CASE("Serialization") {
     NS::Featurizers::RobustScalerTransformer<std::int8_t, std::double_t>    original(1.0, 2.0);
     NS::Archive                                                             out;
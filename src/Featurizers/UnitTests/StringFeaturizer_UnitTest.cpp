@@ -106,6 +106,65 @@ TEST_CASE("Use empty strings - error") {
     NS::Featurizers::StringTransformer<nonstd::optional<int>>(true);
 }
 
+TEST_CASE("execute_batch") {
+    std::string                             buffer;
+    std::vector<size_t>                     offsets;
+
+    // Integers
+    {
+        std::vector<std::int64_t> const     input{ 0, -1, 42, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() };
+
+        NS::Featurizers::StringTransformer<std::int64_t>().execute_batch(input.data(), input.size(), buffer, offsets);
+
+        CHECK(buffer == "0-142-92233720368547758089223372036854775807");
+        CHECK(offsets == std::vector<size_t>{ 0, 1, 3, 5, 25, 44 });
+    }
+
+    // Floating point (the buffers are reused)
+    {
+        std::vector<float> const            input{ 1.5f, NS::Traits<float>::CreateNullValue(), -0.25f };
+
+        NS::Featurizers::StringTransformer<float>().execute_batch(input.data(), input.size(), buffer, offsets);
+
+        CHECK(buffer == "1.500000NaN-0.250000");
+        CHECK(offsets == std::vector<size_t>{ 0, 8, 11, 20 });
+
+        NS::Featurizers::StringTransformer<float>(true).execute_batch(input.data(), input.size(), buffer, offsets);
+
+        CHECK(buffer == "1.500000-0.250000");
+        CHECK(offsets == std::vector<size_t>{ 0, 8, 8, 17 });
+    }
+
+    // Other types
+    {
+        bool const                          input[] = { true, false };
+
+        NS::Featurizers::StringTransformer<bool>().execute_batch(input, 2, buffer, offsets);
+
+        CHECK(buffer == "TrueFalse");
+        CHECK(offsets == std::vector<size_t>{ 0, 4, 9 });
+    }
+
+    // Consistency with execute
+    {
+        std::vector<double> const           input{ 123.45, 135453984983490.5473, 1e-7, 0.0000005, 1e300, -4294967295.75, 2.0 / 3.0 };
+
+        NS::Featurizers::StringTransformer<double>  transformer;
+
+        transformer.execute_batch(input.data(), input.size(), buffer, offsets);
+
+        REQUIRE(offsets.size() == input.size() + 1);
+
+        for(size_t i = 0; i < input.size(); ++i)
+            CHECK(buffer.substr(offsets[i], offsets[i + 1] - offsets[i]) == transformer.execute(input[i]));
+    }
+
+    NS::Featurizers::StringTransformer<int>().execute_batch(nullptr, 0, buffer, offsets);
+
+    CHECK(buffer.empty());
+    CHECK(offsets == std::vector<size_t>{ 0 });
+}
+
 TEST_CASE("Serialization") {
     NS::Featurizers::StringTransformer<std::string>     original;
     NS::Archive                                         out;
@@ -10,6 +10,7 @@
 #include "../TfidfVectorizerFeaturizer.h"
 #include "../Structs.h"
 #include "../TestHelpers.h"
+#include "../AllocationCountingTestHelpers.h"
 #include "../../Traits.h"
 
 namespace NS = Microsoft::Featurizer;
@@ -859,3 +860,44 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Steady-state allocations") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+    using TransformedType = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+    for(AnalyzerMethod analyzer : { AnalyzerMethod::Word, AnalyzerMethod::Char }) {
+        TransformerType                     transformer(
+            IndexMap({{"first", 0}, {"document", 1}, {"this", 2}, {"is", 3}, {"d", 4}, {"t", 5}}),
+            IndexMap({{"first", 1}, {"document", 2}, {"this", 2}, {"is", 2}, {"d", 1}, {"t", 2}}),
+            2,
+            NormMethod::L2,
+            TfidfPolicy::UseIdf|TfidfPolicy::SmoothIdf,
+            true,
+            analyzer,
+            "",
+            1,
+            1
+        );
+
+        std::string const                   longInput("THIS is the FIRST document, this is");
+        std::string const                   shortInput("is this the first");
+        size_t                              numResults(0);
+        TransformerType::CallbackFunction const     callback(
+            [&numResults](TransformedType result) {
+                numResults += result.Values.size();
+            }
+        );
+
+        // The first document warms up the arena
+        transformer.execute(longInput, callback);
+
+        size_t const                        numAllocations(NS::TestHelpers::g_numAllocations);
+
+        transformer.execute(longInput, callback);
+        transformer.execute(shortInput, callback);
+
+        // The only allocation made per document is the vector owned by the result
+        CHECK(NS::TestHelpers::g_numAllocations - numAllocations == 2);
+        CHECK(numResults != 0);
+    }
+}
@@ -38,14 +38,16 @@ using TransformedType = std::vector<
 >;
 
 TransformedType Test(std::vector<std::vector<InputType>> const &trainingBatches, std::vector<InputType> const &inferenceBatches
-,std::vector<NS::TypeId> colsToImputeDataTypes, bool supressError, NS::Featurizers::Components::TimeSeriesImputeStrategy tsImputeStrategy) {
+,std::vector<NS::TypeId> colsToImputeDataTypes, bool supressError, NS::Featurizers::Components::TimeSeriesImputeStrategy tsImputeStrategy
+,std::uint32_t maxLookahead = std::numeric_limits<std::uint32_t>::max(), NS::Featurizers::Components::TimeSeriesLookaheadPolicy lookaheadPolicy = NS::Featurizers::Components::TimeSeriesLookaheadPolicy::EmitAsNull
+,std::uint32_t numTrainingThreads = 1) {
     using KeyT                      = std::vector<std::string>;
     using ColsToImputeT             = std::vector<nonstd::optional<std::string>>;
     using InputBatchesType          = std::vector<std::vector<InputType>>;
     using TSImputerEstimator        = NS::Featurizers::TimeSeriesImputerEstimator;
 
     NS::AnnotationMapsPtr const     pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
-    TSImputerEstimator              estimator(pAllColumnAnnotations,colsToImputeDataTypes,supressError,tsImputeStrategy);
+    TSImputerEstimator              estimator(pAllColumnAnnotations,colsToImputeDataTypes,supressError,tsImputeStrategy,maxLookahead,lookaheadPolicy,numTrainingThreads);
 
     NS::TestHelpers::Train<TSImputerEstimator, InputType>(estimator, trainingBatches);
     TSImputerEstimator::TransformerUniquePtr                  pTransformer(estimator.create_transformer());
@@ -720,6 +722,65 @@ TEST_CASE("BFill- Add Rows and Impute") {
     }
 
 
+TEST_CASE("BFill- Lookahead emits nulls") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}),
+                    std::make_tuple(true,GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{}}),
+                    std::make_tuple(false,GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"}),
+                    std::make_tuple(true,GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"}),
+                    std::make_tuple(false,GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"})
+                };
+    CHECK(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"15.0"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}),
+                    std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"})
+               },{NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward, 2, NS::Featurizers::Components::TimeSeriesLookaheadPolicy::EmitAsNull) == output);
+    }
+
+TEST_CASE("BFill- Lookahead error") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    CHECK_THROWS_WITH(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"15.0"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}),
+                    std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"})
+               },{NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward, 2, NS::Featurizers::Components::TimeSeriesLookaheadPolicy::Error)
+               , Catch::Contains("The maximum lookahead was exceeded."));
+    }
+
+TEST_CASE("BFill- Lookahead not exceeded") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}),
+                    std::make_tuple(true,GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"}),
+                    std::make_tuple(false,GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"}),
+                    std::make_tuple(false,GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"})
+                };
+    CHECK(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"15.0"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}),
+                    std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5"})
+               },{NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward, 2, NS::Featurizers::Components::TimeSeriesLookaheadPolicy::Error) == output);
+    }
+
 TEST_CASE("MedianFill- Add Rows and Impute") {
     std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
     std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>>
@@ -768,6 +829,68 @@ TEST_CASE("MedianFill- Add Rows and Impute") {
     CHECK(actual_output == expected_output);
 }
 
+TEST_CASE("Interpolate- Add Rows and Impute") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"10","2"}),
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"1"}),
+                    std::make_tuple(true,GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"12.000000","4.000000"}),
+                    std::make_tuple(true,GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.000000","6.000000"}),
+                    std::make_tuple(false,GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"16.000000","8"}),
+                    std::make_tuple(false,GetTimePoint(now,1), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"5","2.500000"}),
+                    std::make_tuple(false,GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"18",nonstd::optional<std::string>{}}),
+                    std::make_tuple(false,GetTimePoint(now,2), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"4"})
+                };
+    CHECK(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5","18"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"15.0","12"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"10","2"}),
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"1"}),
+                    std::make_tuple(GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"8"}),
+                    std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"5",nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"18",nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"4"})
+               },{NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Interpolate) == output);
+    }
+
+TEST_CASE("Suppress Error: Interpolate on unsupported column types") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    CHECK_THROWS_WITH(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5","def"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"abc"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},nonstd::optional<std::string>{}})
+                },{NS::TypeId::Float64,NS::TypeId::String}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Interpolate)
+                , Catch::Contains("Only Numeric type columns are supported for ImputationStrategy interpolate. (use suppressError flag to skip imputing non-numeric types)"));
+    }
+
+TEST_CASE("Suppress Error: Interpolate on unsupported column types with suppress error flag turned on") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1","abc"}),
+                    std::make_tuple(false,GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000",nonstd::optional<std::string>{}}),
+                    std::make_tuple(false,GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"3","def"})
+                };
+    CHECK(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5","def"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"abc"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1","abc"}),
+                    std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"3","def"})
+                },{NS::TypeId::Float64,NS::TypeId::String}, true, NS::Featurizers::Components::TimeSeriesImputeStrategy::Interpolate) == output);
+    }
+
 TEST_CASE("One Row input") {
     std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
 
@@ -905,6 +1028,30 @@ TEST_CASE("Median Test - suppress error") {
     CHECK(actual_output == expected_output);
 }
 
+TEST_CASE("Median Test - skewed values") {
+    // The imputed value is the median (2.0) rather than the mean (11.0)
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>>
+        input =
+            {
+                std::make_tuple(GetTimePoint(now, 0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1.000000"}),
+                std::make_tuple(GetTimePoint(now, 1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>()}),
+                std::make_tuple(GetTimePoint(now, 2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"30.000000"}),
+                std::make_tuple(GetTimePoint(now, 4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000"})
+            };
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>>
+        expected_output =
+            {
+                std::make_tuple(false, GetTimePoint(now, 0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1.000000"}),
+                std::make_tuple(false, GetTimePoint(now, 1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000"}),
+                std::make_tuple(false, GetTimePoint(now, 2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"30.000000"}),
+                std::make_tuple(true, GetTimePoint(now, 3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000"}),
+                std::make_tuple(false, GetTimePoint(now, 4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000"})
+            };
+
+    CHECK(Test({input}, {input}, {NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Median) == expected_output);
+}
+
 TEST_CASE("Serialization") {
     // Today, it isn't easy to create a TimeSeriesImputerTransformer in isolation. For now,
     // create the Estimator and then create the Transformer.
@@ -944,3 +1091,196 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+std::vector<InputType> GetMultiGrainInput(std::chrono::system_clock::time_point now) {
+    // Rows of 10 interleaved grains, with gaps and null values
+    std::vector<InputType>                  result;
+
+    for(int day = 0; day < 40; ++day) {
+        for(int grain = 0; grain < 10; ++grain) {
+            if((day + grain) % 7 == 3)
+                continue;
+
+            nonstd::optional<std::string>   value;
+
+            if((day * grain) % 5 != 1)
+                value = std::to_string(day * 10 + grain);
+
+            result.emplace_back(GetTimePoint(now, day), std::vector<std::string>{std::to_string(grain)}, std::vector<nonstd::optional<std::string>>{value});
+        }
+    }
+
+    return result;
+}
+
+TEST_CASE("Parallel training") {
+    std::chrono::system_clock::time_point   now = std::chrono::system_clock::now();
+    std::vector<InputType> const            input(GetMultiGrainInput(now));
+
+    for(auto strategy : {NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward, NS::Featurizers::Components::TimeSeriesImputeStrategy::Median}) {
+        TransformedType const               expected(Test({input}, input, {NS::TypeId::Float64}, false, strategy));
+
+        CHECK(Test({input}, input, {NS::TypeId::Float64}, false, strategy, std::numeric_limits<std::uint32_t>::max(), NS::Featurizers::Components::TimeSeriesLookaheadPolicy::EmitAsNull, 4) == expected);
+    }
+
+    std::vector<InputType>                  outOfOrder(input);
+
+    std::swap(outOfOrder[0], outOfOrder[20]);
+    CHECK_THROWS_WITH(Test({outOfOrder}, input, {NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward, std::numeric_limits<std::uint32_t>::max(), NS::Featurizers::Components::TimeSeriesLookaheadPolicy::EmitAsNull, 4), "Input stream not in chronological order.");
+}
+
+TEST_CASE("Parallel batch execution") {
+    using TransformerType                   = NS::Featurizers::Components::TimeSeriesImputerEstimator::Transformer;
+
+    std::chrono::system_clock::time_point   now = std::chrono::system_clock::now();
+    std::vector<InputType> const            input(GetMultiGrainInput(now));
+    std::map<std::vector<std::string>, std::vector<double>>     medians;
+
+    for(int grain = 0; grain < 10; ++grain)
+        medians.emplace(std::vector<std::string>{std::to_string(grain)}, std::vector<double>{static_cast<double>(grain)});
+
+    for(auto strategy : {
+        NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward,
+        NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward,
+        NS::Featurizers::Components::TimeSeriesImputeStrategy::Median,
+        NS::Featurizers::Components::TimeSeriesImputeStrategy::Interpolate
+    }) {
+        // Split the input into 3 batches
+        std::vector<std::vector<InputType>> batches{
+            std::vector<InputType>(input.begin(), input.begin() + 100),
+            std::vector<InputType>(input.begin() + 100, input.begin() + 101),
+            std::vector<InputType>(input.begin() + 101, input.end())
+        };
+
+        TransformerType                     serialTransformer(std::chrono::hours(24), {NS::TypeId::Float64}, strategy, false, medians);
+        TransformerType                     batchTransformer(std::chrono::hours(24), {NS::TypeId::Float64}, strategy, false, medians);
+
+        for(auto const &batch : batches) {
+            // The batch output is the serial output grouped by the first
+            // appearance of each grain in the batch
+            TransformedType                 serial;
+            std::vector<std::string>        grainOrder;
+
+            for(auto const &row : batch) {
+                serialTransformer.execute(
+                    row,
+                    [&serial](TransformedType::value_type value) {
+                        serial.emplace_back(std::move(value));
+                    }
+                );
+
+                if(std::find(grainOrder.begin(), grainOrder.end(), std::get<1>(row)[0]) == grainOrder.end())
+                    grainOrder.emplace_back(std::get<1>(row)[0]);
+            }
+
+            TransformedType                 expected;
+
+            for(auto const &grain : grainOrder) {
+                for(auto const &row : serial) {
+                    if(std::get<2>(row)[0] == grain)
+                        expected.emplace_back(row);
+                }
+            }
+
+            TransformedType                 actual;
+
+            batchTransformer.execute_batch(
+                batch.data(),
+                batch.size(),
+                [&actual](TransformedType::value_type value) {
+                    actual.emplace_back(std::move(value));
+                },
+                4
+            );
+
+            CHECK(actual == expected);
+        }
+
+        // Flushed rows are the same
+        TransformedType                     serialFlushed;
+        TransformedType                     batchFlushed;
+
+        serialTransformer.flush([&serialFlushed](TransformedType::value_type value) { serialFlushed.emplace_back(std::move(value)); });
+        batchTransformer.flush([&batchFlushed](TransformedType::value_type value) { batchFlushed.emplace_back(std::move(value)); });
+
+        CHECK(batchFlushed == serialFlushed);
+    }
+}
+
+TEST_CASE("Move between executions") {
+    using TransformerType                   = NS::Featurizers::Components::TimeSeriesImputerEstimator::Transformer;
+
+    std::chrono::system_clock::time_point   now = std::chrono::system_clock::now();
+    TransformedType                         output;
+    auto const                              callback(
+        [&output](TransformedType::value_type value) {
+            output.emplace_back(std::move(value));
+        }
+    );
+
+    std::unique_ptr<TransformerType>        pOriginal(
+        new TransformerType(
+            std::chrono::hours(24),
+            {NS::TypeId::Float64},
+            NS::Featurizers::Components::TimeSeriesImputeStrategy::Median,
+            false,
+            std::map<std::vector<std::string>, std::vector<double>>{{std::vector<std::string>{"a"}, std::vector<double>{5.0}}}
+        )
+    );
+
+    // Create the state for grain "a" before the move
+    pOriginal->execute(std::make_tuple(GetTimePoint(now, 0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1.0"}), callback);
+
+    TransformerType                         transformer(std::move(*pOriginal));
+
+    // The state for grain "a" must not reference the moved-from Transformer
+    pOriginal.reset();
+
+    transformer.execute(std::make_tuple(GetTimePoint(now, 1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>()}), callback);
+    transformer.flush(callback);
+
+    CHECK(
+        output == TransformedType{
+            std::make_tuple(false, GetTimePoint(now, 0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1.0"}),
+            std::make_tuple(false, GetTimePoint(now, 1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5.000000"})
+        }
+    );
+}
+
+TEST_CASE("Large gap") {
+    using TransformerType                   = NS::Featurizers::Components::TimeSeriesImputerEstimator::Transformer;
+
+    std::chrono::system_clock::time_point   now = std::chrono::system_clock::now();
+    int const                               gap(10000);
+
+    for(auto strategy : {
+        NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward,
+        NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward
+    }) {
+        TransformerType                     transformer(std::chrono::hours(24), {NS::TypeId::Float64}, strategy, false, std::map<std::vector<std::string>, std::vector<double>>());
+        size_t                              numAdded(0);
+        size_t                              numRows(0);
+        nonstd::optional<std::string> const expectedValue(strategy == NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward ? "1.000000" : "2.000000");
+        auto const                          callback(
+            [&](TransformedType::value_type value) {
+                ++numRows;
+
+                if(std::get<0>(value) == false)
+                    return;
+
+                ++numAdded;
+                CHECK(std::get<2>(value) == std::vector<std::string>{"a"});
+
+                if(std::get<3>(value)[0] != expectedValue)
+                    CHECK(std::get<3>(value)[0] == expectedValue);
+            }
+        );
+
+        transformer.execute(std::make_tuple(GetTimePoint(now, 0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1.000000"}), callback);
+        transformer.execute(std::make_tuple(GetTimePoint(now, gap), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000"}), callback);
+        transformer.flush(callback);
+
+        CHECK(numAdded == static_cast<size_t>(gap - 1));
+        CHECK(numRows == static_cast<size_t>(gap + 1));
+    }
+}
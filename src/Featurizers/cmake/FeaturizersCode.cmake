@@ -17,6 +17,8 @@ function(Impl)
         ${_this_path}/../CountVectorizerFeaturizer.cpp
         ${_this_path}/../DateTimeFeaturizer.h
         ${_this_path}/../DateTimeFeaturizer.cpp
+        ${_this_path}/../DateTimeFeaturizerData/HolidayTables.h
+        ${_this_path}/../DateTimeFeaturizerData/GeneratedCode/HolidayTables.cpp
         ${_this_path}/../FromStringFeaturizer.h
         ${_this_path}/../HashOneHotVectorizerFeaturizer.h
         ${_this_path}/../ImputationMarkerFeaturizer.h
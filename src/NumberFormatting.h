@@ -0,0 +1,504 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace NumberFormatting {
+
+// ----------------------------------------------------------------------
+// |
+// |  Buffer Sizes
+// |
+// ----------------------------------------------------------------------
+
+/// Max number of chars written by `FormatInteger` ("-9223372036854775808" and "18446744073709551615")
+static constexpr size_t const               MaxIntegerChars = 20;
+
+/// Max number of chars written by `FormatFixed` (309 integer digits, a sign, a decimal point,
+/// 6 fractional digits, and a null terminator used by the fallback implementation)
+static constexpr size_t const               MaxFixedChars = 320;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            FormatInteger
+///  \brief         Writes the decimal representation of an integer to `pBuffer`
+///                 (which must be at least `MaxIntegerChars` in size) and returns
+///                 the number of chars written. The output is the same as
+///                 `std::to_string` and the buffer is not null-terminated.
+///
+template <typename T>
+size_t FormatInteger(T value, char *pBuffer);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            FormatFixed
+///  \brief         Writes a floating point value with 6 fractional digits to
+///                 `pBuffer` (which must be at least `MaxFixedChars` in size)
+///                 and returns the number of chars written. The output is the
+///                 same as `std::to_string`.
+///
+///                 Values with a magnitude less than 2^32 whose shortest
+///                 representation has at most 6 fractional digits (which is
+///                 the case for most real-world data) are written without
+///                 calling into the C runtime.
+///
+template <typename T>
+size_t FormatFixed(T value, char *pBuffer);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+inline char const * DigitPairs(void) {
+    static char const                       pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    return pairs;
+}
+
+inline size_t NumDigits(std::uint64_t value) {
+    size_t                                  result(1);
+
+    while(true) {
+        if(value < 10) return result;
+        if(value < 100) return result + 1;
+        if(value < 1000) return result + 2;
+        if(value < 10000) return result + 3;
+
+        value /= 10000;
+        result += 4;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            FormatUnsigned
+///  \brief         Writes the digits of `value` two at a time, from the end of
+///                 the output.
+///
+inline size_t FormatUnsigned(std::uint64_t value, char *pBuffer) {
+    char const * const                      pPairs(DigitPairs());
+    size_t const                            numDigits(NumDigits(value));
+    char *                                  pEnd(pBuffer + numDigits);
+
+    while(value >= 100) {
+        size_t const                        index(static_cast<size_t>(value % 100) * 2);
+
+        value /= 100;
+
+        *--pEnd = pPairs[index + 1];
+        *--pEnd = pPairs[index];
+    }
+
+    if(value >= 10) {
+        size_t const                        index(static_cast<size_t>(value) * 2);
+
+        *--pEnd = pPairs[index + 1];
+        *--pEnd = pPairs[index];
+    }
+    else
+        *--pEnd = static_cast<char>('0' + value);
+
+    assert(pEnd == pBuffer);
+    return numDigits;
+}
+
+template <typename T>
+size_t FormatIntegerImpl(T value, char *pBuffer, std::true_type /*is_signed*/) {
+    if(value < 0) {
+        *pBuffer = '-';
+
+        // Negate in unsigned arithmetic so that the min value doesn't overflow
+        return FormatUnsigned(static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(static_cast<std::int64_t>(value)), pBuffer + 1) + 1;
+    }
+
+    return FormatUnsigned(static_cast<std::uint64_t>(value), pBuffer);
+}
+
+template <typename T>
+size_t FormatIntegerImpl(T value, char *pBuffer, std::false_type /*is_signed*/) {
+    return FormatUnsigned(static_cast<std::uint64_t>(value), pBuffer);
+}
+
+// ----------------------------------------------------------------------
+// |  Grisu2
+// |
+// |  Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+// |  with Integers" (PLDI 2010). The implementation follows the one in
+// |  3rdParty/json.h, which uses (alpha, gamma) = (-60, -32).
+// ----------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DiyFp
+///  \brief         f * 2^e
+///
+struct DiyFp {
+    std::uint64_t                           f;
+    int                                     e;
+
+    DiyFp(std::uint64_t f_, int e_) : f(f_), e(e_) {}
+
+    static DiyFp Sub(DiyFp const &x, DiyFp const &y) {
+        assert(x.e == y.e);
+        assert(x.f >= y.f);
+
+        return DiyFp(x.f - y.f, x.e);
+    }
+
+    // Returns the upper 64 bits of the product (rounded)
+    static DiyFp Mul(DiyFp const &x, DiyFp const &y) {
+        std::uint64_t const                 uLo(x.f & 0xFFFFFFFFu);
+        std::uint64_t const                 uHi(x.f >> 32);
+        std::uint64_t const                 vLo(y.f & 0xFFFFFFFFu);
+        std::uint64_t const                 vHi(y.f >> 32);
+
+        std::uint64_t const                 p0(uLo * vLo);
+        std::uint64_t const                 p1(uLo * vHi);
+        std::uint64_t const                 p2(uHi * vLo);
+        std::uint64_t const                 p3(uHi * vHi);
+
+        std::uint64_t                       q((p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu));
+
+        q += static_cast<std::uint64_t>(1) << 31; // Round, ties up
+
+        return DiyFp(p3 + (p2 >> 32) + (p1 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    static DiyFp Normalize(DiyFp x) {
+        assert(x.f != 0);
+
+        while((x.f >> 63) == 0) {
+            x.f <<= 1;
+            --x.e;
+        }
+
+        return x;
+    }
+
+    static DiyFp NormalizeTo(DiyFp const &x, int targetExponent) {
+        int const                           delta(x.e - targetExponent);
+
+        assert(delta >= 0);
+        assert(((x.f << delta) >> delta) == x.f);
+
+        return DiyFp(x.f << delta, targetExponent);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Boundaries
+///  \brief         A value and the midpoints to its neighbors; all values
+///                 strictly between `Minus` and `Plus` round to `W`.
+///
+struct Boundaries {
+    DiyFp                                   W;
+    DiyFp                                   Minus;
+    DiyFp                                   Plus;
+};
+
+template <typename T>
+Boundaries ComputeBoundaries(T value) {
+    static_assert(std::numeric_limits<T>::is_iec559, "IEEE-754 floating point values are required");
+
+    // ----------------------------------------------------------------------
+    using BitsType                          = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+    // ----------------------------------------------------------------------
+
+    assert(std::isfinite(value) && value > 0);
+
+    int const                               precision(std::numeric_limits<T>::digits);
+    int const                               bias(std::numeric_limits<T>::max_exponent - 1 + (precision - 1));
+    int const                               minExp(1 - bias);
+    std::uint64_t const                     hiddenBit(static_cast<std::uint64_t>(1) << (precision - 1));
+
+    BitsType                                bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    std::uint64_t const                     exponentBits(static_cast<std::uint64_t>(bits) >> (precision - 1));
+    std::uint64_t const                     fractionBits(static_cast<std::uint64_t>(bits) & (hiddenBit - 1));
+
+    DiyFp const                             v(
+        exponentBits == 0
+            ? DiyFp(fractionBits, minExp)
+            : DiyFp(fractionBits + hiddenBit, static_cast<int>(exponentBits) - bias)
+    );
+
+    bool const                              lowerBoundaryIsCloser(fractionBits == 0 && exponentBits > 1);
+    DiyFp const                             plus(2 * v.f + 1, v.e - 1);
+    DiyFp const                             minus(
+        lowerBoundaryIsCloser
+            ? DiyFp(4 * v.f - 1, v.e - 2)
+            : DiyFp(2 * v.f - 1, v.e - 1)
+    );
+
+    DiyFp const                             normalizedPlus(DiyFp::Normalize(plus));
+
+    return Boundaries{ DiyFp::Normalize(v), DiyFp::NormalizeTo(minus, normalizedPlus.e), normalizedPlus };
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CachedPower
+///  \brief         f * 2^e ~= 10^k
+///
+struct CachedPower {
+    std::uint64_t                           f;
+    int                                     e;
+    int                                     k;
+};
+
+inline CachedPower GetCachedPowerForBinaryExponent(int e) {
+    static CachedPower const                cachedPowers[] = {
+        { 0xAB70FE17C79AC6CA, -1060, -300 }, { 0xFF77B1FCBEBCDC4F, -1034, -292 }, { 0xBE5691EF416BD60C, -1007, -284 },
+        { 0x8DD01FAD907FFC3C,  -980, -276 }, { 0xD3515C2831559A83,  -954, -268 }, { 0x9D71AC8FADA6C9B5,  -927, -260 },
+        { 0xEA9C227723EE8BCB,  -901, -252 }, { 0xAECC49914078536D,  -874, -244 }, { 0x823C12795DB6CE57,  -847, -236 },
+        { 0xC21094364DFB5637,  -821, -228 }, { 0x9096EA6F3848984F,  -794, -220 }, { 0xD77485CB25823AC7,  -768, -212 },
+        { 0xA086CFCD97BF97F4,  -741, -204 }, { 0xEF340A98172AACE5,  -715, -196 }, { 0xB23867FB2A35B28E,  -688, -188 },
+        { 0x84C8D4DFD2C63F3B,  -661, -180 }, { 0xC5DD44271AD3CDBA,  -635, -172 }, { 0x936B9FCEBB25C996,  -608, -164 },
+        { 0xDBAC6C247D62A584,  -582, -156 }, { 0xA3AB66580D5FDAF6,  -555, -148 }, { 0xF3E2F893DEC3F126,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8,  -502, -132 }, { 0x87625F056C7C4A8B,  -475, -124 }, { 0xC9BCFF6034C13053,  -449, -116 },
+        { 0x964E858C91BA2655,  -422, -108 }, { 0xDFF9772470297EBD,  -396, -100 }, { 0xA6DFBD9FB8E5B88F,  -369,  -92 },
+        { 0xF8A95FCF88747D94,  -343,  -84 }, { 0xB94470938FA89BCF,  -316,  -76 }, { 0x8A08F0F8BF0F156B,  -289,  -68 },
+        { 0xCDB02555653131B6,  -263,  -60 }, { 0x993FE2C6D07B7FAC,  -236,  -52 }, { 0xE45C10C42A2B3B06,  -210,  -44 },
+        { 0xAA242499697392D3,  -183,  -36 }, { 0xFD87B5F28300CA0E,  -157,  -28 }, { 0xBCE5086492111AEB,  -130,  -20 },
+        { 0x8CBCCC096F5088CC,  -103,  -12 }, { 0xD1B71758E219652C,   -77,   -4 }, { 0x9C40000000000000,   -50,    4 },
+        { 0xE8D4A51000000000,   -24,   12 }, { 0xAD78EBC5AC620000,     3,   20 }, { 0x813F3978F8940984,    30,   28 },
+        { 0xC097CE7BC90715B3,    56,   36 }, { 0x8F7E32CE7BEA5C70,    83,   44 }, { 0xD5D238A4ABE98068,   109,   52 },
+        { 0x9F4F2726179A2245,   136,   60 }, { 0xED63A231D4C4FB27,   162,   68 }, { 0xB0DE65388CC8ADA8,   189,   76 },
+        { 0x83C7088E1AAB65DB,   216,   84 }, { 0xC45D1DF942711D9A,   242,   92 }, { 0x924D692CA61BE758,   269,  100 },
+        { 0xDA01EE641A708DEA,   295,  108 }, { 0xA26DA3999AEF774A,   322,  116 }, { 0xF209787BB47D6B85,   348,  124 },
+        { 0xB454E4A179DD1877,   375,  132 }, { 0x865B86925B9BC5C2,   402,  140 }, { 0xC83553C5C8965D3D,   428,  148 },
+        { 0x952AB45CFA97A0B3,   455,  156 }, { 0xDE469FBD99A05FE3,   481,  164 }, { 0xA59BC234DB398C25,   508,  172 },
+        { 0xF6C69A72A3989F5C,   534,  180 }, { 0xB7DCBF5354E9BECE,   561,  188 }, { 0x88FCF317F22241E2,   588,  196 },
+        { 0xCC20CE9BD35C78A5,   614,  204 }, { 0x98165AF37B2153DF,   641,  212 }, { 0xE2A0B5DC971F303A,   667,  220 },
+        { 0xA8D9D1535CE3B396,   694,  228 }, { 0xFB9B7CD9A4A7443C,   720,  236 }, { 0xBB764C4CA7A44410,   747,  244 },
+        { 0x8BAB8EEFB6409C1A,   774,  252 }, { 0xD01FEF10A657842C,   800,  260 }, { 0x9B10A4E5E9913129,   827,  268 },
+        { 0xE7109BFBA19C0C9D,   853,  276 }, { 0xAC2820D9623BF429,   880,  284 }, { 0x80444B5E7AA7CF85,   907,  292 },
+        { 0xBF21E44003ACDD2D,   933,  300 }, { 0x8E679C2F5E44FF8F,   960,  308 }, { 0xD433179D9C8CB841,   986,  316 },
+        { 0x9E19DB92B4E31BA9,  1013,  324 }
+    };
+
+    int const                               alpha(-60);
+    int const                               minDecExp(-300);
+    int const                               decStep(8);
+
+    // k = ceil((alpha - e - 1) * log10(2)), where log10(2) ~= 78913 / 2^18
+    int const                               f(alpha - e - 1);
+    int const                               k((f * 78913) / (1 << 18) + static_cast<int>(f > 0));
+    int const                               index((-minDecExp + k + (decStep - 1)) / decStep);
+
+    assert(index >= 0 && static_cast<size_t>(index) < sizeof(cachedPowers) / sizeof(*cachedPowers));
+    return cachedPowers[index];
+}
+
+inline int FindLargestPow10(std::uint32_t n, std::uint32_t &pow10) {
+    static std::uint32_t const              powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+    int                                     numDigits(10);
+
+    while(numDigits > 1 && n < powers[numDigits - 1])
+        --numDigits;
+
+    pow10 = powers[numDigits - 1];
+    return numDigits;
+}
+
+inline void Grisu2Round(char *pBuffer, int length, std::uint64_t dist, std::uint64_t delta, std::uint64_t rest, std::uint64_t tenK) {
+    assert(length >= 1);
+
+    while(
+        rest < dist
+        && delta - rest >= tenK
+        && (rest + tenK < dist || dist - rest > rest + tenK - dist)
+    ) {
+        assert(pBuffer[length - 1] != '0');
+        --pBuffer[length - 1];
+        rest += tenK;
+    }
+}
+
+inline void Grisu2DigitGen(char *pBuffer, int &length, int &decimalExponent, DiyFp mMinus, DiyFp w, DiyFp mPlus) {
+    std::uint64_t                           delta(DiyFp::Sub(mPlus, mMinus).f);
+    std::uint64_t                           dist(DiyFp::Sub(mPlus, w).f);
+
+    DiyFp const                             one(static_cast<std::uint64_t>(1) << -mPlus.e, mPlus.e);
+
+    std::uint32_t                           p1(static_cast<std::uint32_t>(mPlus.f >> -one.e));
+    std::uint64_t                           p2(mPlus.f & (one.f - 1));
+
+    assert(p1 > 0);
+
+    // Integral digits
+    std::uint32_t                           pow10;
+    int                                     n(FindLargestPow10(p1, pow10));
+
+    while(n > 0) {
+        std::uint32_t const                 d(p1 / pow10);
+
+        p1 %= pow10;
+        pBuffer[length++] = static_cast<char>('0' + d);
+        --n;
+
+        std::uint64_t const                 rest((static_cast<std::uint64_t>(p1) << -one.e) + p2);
+
+        if(rest <= delta) {
+            decimalExponent += n;
+            Grisu2Round(pBuffer, length, dist, delta, rest, static_cast<std::uint64_t>(pow10) << -one.e);
+            return;
+        }
+
+        pow10 /= 10;
+    }
+
+    // Fractional digits
+    int                                     m(0);
+
+    while(true) {
+        p2 *= 10;
+
+        std::uint64_t const                 d(p2 >> -one.e);
+
+        p2 &= one.f - 1;
+        pBuffer[length++] = static_cast<char>('0' + d);
+        ++m;
+
+        delta *= 10;
+        dist *= 10;
+
+        if(p2 <= delta)
+            break;
+    }
+
+    decimalExponent -= m;
+    Grisu2Round(pBuffer, length, dist, delta, p2, one.f);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            Grisu2
+///  \brief         Generates digits such that value ~= digits * 10^decimalExponent.
+///                 `pBuffer` must be at least 17 chars.
+///
+template <typename T>
+void Grisu2(T value, char *pBuffer, int &length, int &decimalExponent) {
+    Boundaries const                        b(ComputeBoundaries(value));
+    CachedPower const                       cached(GetCachedPowerForBinaryExponent(b.Plus.e));
+    DiyFp const                             c(cached.f, cached.e);
+
+    DiyFp const                             w(DiyFp::Mul(b.W, c));
+    DiyFp const                             wMinus(DiyFp::Mul(b.Minus, c));
+    DiyFp const                             wPlus(DiyFp::Mul(b.Plus, c));
+
+    length = 0;
+    decimalExponent = -cached.k;
+
+    Grisu2DigitGen(
+        pBuffer,
+        length,
+        decimalExponent,
+        DiyFp(wMinus.f + 1, wMinus.e),
+        w,
+        DiyFp(wPlus.f - 1, wPlus.e)
+    );
+}
+
+} // namespace Details
+
+template <typename T>
+size_t FormatInteger(T value, char *pBuffer) {
+    static_assert(std::is_integral<T>::value, "Integral types are required");
+
+    return Details::FormatIntegerImpl(value, pBuffer, std::integral_constant<bool, std::is_signed<T>::value>());
+}
+
+template <typename T>
+size_t FormatFixed(T valueParam, char *pBuffer) {
+    static_assert(std::is_floating_point<T>::value && sizeof(T) <= 8, "float or double is required");
+
+    // `std::to_string` promotes floats to doubles
+    double const                            value(static_cast<double>(valueParam));
+
+    if(std::isfinite(value) && std::abs(value) < 4294967296.0) {
+        char *                              pOutput(pBuffer);
+
+        if(std::signbit(value))
+            *pOutput++ = '-';
+
+        double const                        absValue(std::abs(value));
+
+        if(absValue == 0) {
+            std::memcpy(pOutput, "0.000000", 8);
+            return static_cast<size_t>(pOutput - pBuffer) + 8;
+        }
+
+        char                                digits[20];
+        int                                 numDigits;
+        int                                 decimalExponent;
+
+        Details::Grisu2(absValue, digits, numDigits, decimalExponent);
+
+        // The digits are within half an ulp of the value; when the value is less than
+        // 2^32, half an ulp is less than 0.5e-6, which means that the 6-digit rounding
+        // of the value is the same as the digits when there are no more than 6 fractional
+        // digits.
+        if(decimalExponent >= -6) {
+            int const                       numIntegerDigits(numDigits + decimalExponent);
+
+            if(numIntegerDigits <= 0)
+                *pOutput++ = '0';
+            else {
+                int const                   numCopy(numIntegerDigits < numDigits ? numIntegerDigits : numDigits);
+
+                std::memcpy(pOutput, digits, static_cast<size_t>(numCopy));
+                pOutput += numCopy;
+
+                std::memset(pOutput, '0', static_cast<size_t>(numIntegerDigits - numCopy));
+                pOutput += numIntegerDigits - numCopy;
+            }
+
+            *pOutput++ = '.';
+
+            // Fractional digits: 6 chars, where digit i (1-based) after the decimal point
+            // corresponds to index (numIntegerDigits + i - 1) in `digits`.
+            for(int i = 0; i < 6; ++i) {
+                int const                   index(numIntegerDigits + i);
+
+                *pOutput++ = index >= 0 && index < numDigits ? digits[index] : '0';
+            }
+
+            return static_cast<size_t>(pOutput - pBuffer);
+        }
+    }
+
+    int const                               result(std::snprintf(pBuffer, MaxFixedChars, "%f", value));
+
+    assert(result > 0 && static_cast<size_t>(result) < MaxFixedChars);
+    return static_cast<size_t>(result);
+}
+
+} // namespace NumberFormatting
+} // namespace Featurizer
+} // namespace Microsoft
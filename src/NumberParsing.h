@@ -0,0 +1,452 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace NumberParsing {
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          ParseResult
+///  \brief         Result of a `TryParse` call.
+///
+enum class ParseResult {
+    Success,
+    Invalid,                                // The text is not a number
+    OutOfRange                              // The text is a number that can't be represented by the type
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            TryParse
+///  \brief         Parses the text in [pBuffer, pBuffer + cBuffer) as an integer
+///                 or floating point value without using the current locale
+///                 or requiring a null-terminated string.
+///
+///                 Accepted text is:
+///                     [whitespace][+|-]digits[.digits][(e|E)[+|-]digits][whitespace]
+///
+///                 where fractional digits and exponents are only valid for
+///                 floating point types, and digits may be omitted on one side
+///                 of the decimal point. Floating point types also accept "NaN",
+///                 "inf", and "infinity" (case insensitive). Any other trailing
+///                 text is invalid.
+///
+///                 Floating point values with up to 19 significant digits are
+///                 converted with exact arithmetic when the mantissa and power
+///                 of 10 can be represented exactly (Clinger's fast path), which
+///                 is the case for most values in CSV data. Other values fall back
+///                 to the C runtime after the text is normalized into a form
+///                 that doesn't have a decimal point (and is therefore not impacted
+///                 by the locale), so the result is always correctly rounded. This
+///                 fallback is the only code path that allocates memory.
+///
+///                 `value` is only modified when the result is `Success`.
+///
+template <typename T>
+ParseResult TryParse(char const *pBuffer, size_t cBuffer, T &value);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            Parse
+///  \brief         Parses the text, throwing `std::invalid_argument` if the text
+///                 is not a valid number or is out of range for the type.
+///
+template <typename T>
+T Parse(char const *pBuffer, size_t cBuffer);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ParseBatch
+///  \brief         Parses a column of `cItems` strings stored contiguously in
+///                 `pBytes`, where item `i` is the range [pOffsets[i], pOffsets[i + 1]).
+///                 `pOffsets` must contain `cItems + 1` elements.
+///
+template <typename T>
+void ParseBatch(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+inline bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+inline char ToLower(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline char const * SkipWhitespace(char const *pBuffer, char const *pEnd) {
+    while(pBuffer != pEnd && IsWhitespace(*pBuffer))
+        ++pBuffer;
+
+    return pBuffer;
+}
+
+inline bool IsValidEnd(char const *pBuffer, char const *pEnd) {
+    return SkipWhitespace(pBuffer, pEnd) == pEnd;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            MatchKeyword
+///  \brief         Case-insensitive comparison of the text with a lower-case
+///                 keyword; returns the end of the keyword if there is a match
+///                 or nullptr if there isn't.
+///
+inline char const * MatchKeyword(char const *pBuffer, char const *pEnd, char const *keyword) {
+    while(*keyword) {
+        if(pBuffer == pEnd || ToLower(*pBuffer) != *keyword)
+            return nullptr;
+
+        ++pBuffer;
+        ++keyword;
+    }
+
+    return pBuffer;
+}
+
+template <typename T>
+ParseResult TryParseImpl(char const *pBuffer, size_t cBuffer, T &value, std::true_type /*is_integral*/) {
+    char const * const                      pEnd(pBuffer + cBuffer);
+
+    pBuffer = SkipWhitespace(pBuffer, pEnd);
+
+    bool                                    isNegative(false);
+
+    if(pBuffer != pEnd && (*pBuffer == '-' || *pBuffer == '+')) {
+        isNegative = *pBuffer == '-';
+        ++pBuffer;
+    }
+
+    if(pBuffer == pEnd || IsDigit(*pBuffer) == false)
+        return ParseResult::Invalid;
+
+    // The magnitude of the min value of a signed type is one more than the max value
+    std::uint64_t const                     limit(
+        isNegative
+            ? (std::is_signed<T>::value ? static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + 1 : 0)
+            : static_cast<std::uint64_t>(std::numeric_limits<T>::max())
+    );
+
+    std::uint64_t                           magnitude(0);
+    bool                                    isOutOfRange(false);
+
+    while(pBuffer != pEnd && IsDigit(*pBuffer)) {
+        std::uint64_t const                 digit(static_cast<std::uint64_t>(*pBuffer - '0'));
+
+        if(digit > limit || magnitude > (limit - digit) / 10)
+            isOutOfRange = true;
+        else
+            magnitude = magnitude * 10 + digit;
+
+        ++pBuffer;
+    }
+
+    if(IsValidEnd(pBuffer, pEnd) == false)
+        return ParseResult::Invalid;
+
+    if(isOutOfRange)
+        return ParseResult::OutOfRange;
+
+    // Negate without overflowing when the value is the min value of the type
+    if(isNegative && magnitude != 0)
+        value = static_cast<T>(static_cast<T>(0) - static_cast<T>(magnitude - 1) - static_cast<T>(1));
+    else
+        value = static_cast<T>(magnitude);
+
+    return ParseResult::Success;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         FloatingPointInfo
+///  \brief         Type-specific limits for the exact fast path: mantissas up
+///                 to 2^digits and powers of 10 up to MaxExactPow10 are exactly
+///                 representable, so a single multiplication or division is
+///                 correctly rounded.
+///
+template <typename T>
+struct FloatingPointInfo;
+
+template <>
+struct FloatingPointInfo<float> {
+    static constexpr int const              MaxExactPow10 = 10;
+
+    static float StrTo(char const *pBuffer) {
+        return std::strtof(pBuffer, nullptr);
+    }
+};
+
+template <>
+struct FloatingPointInfo<double> {
+    static constexpr int const              MaxExactPow10 = 22;
+
+    static double StrTo(char const *pBuffer) {
+        return std::strtod(pBuffer, nullptr);
+    }
+};
+
+template <typename T>
+T Pow10(int exponent) {
+    static T const                          powers[] = {
+        static_cast<T>(1e0), static_cast<T>(1e1), static_cast<T>(1e2), static_cast<T>(1e3), static_cast<T>(1e4), static_cast<T>(1e5),
+        static_cast<T>(1e6), static_cast<T>(1e7), static_cast<T>(1e8), static_cast<T>(1e9), static_cast<T>(1e10), static_cast<T>(1e11),
+        static_cast<T>(1e12), static_cast<T>(1e13), static_cast<T>(1e14), static_cast<T>(1e15), static_cast<T>(1e16), static_cast<T>(1e17),
+        static_cast<T>(1e18), static_cast<T>(1e19), static_cast<T>(1e20), static_cast<T>(1e21), static_cast<T>(1e22)
+    };
+
+    return powers[exponent];
+}
+
+template <typename T>
+ParseResult TryParseImpl(char const *pBuffer, size_t cBuffer, T &value, std::false_type /*is_integral*/) {
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "float or double is required");
+
+    // ----------------------------------------------------------------------
+    using Info                              = FloatingPointInfo<T>;
+    // ----------------------------------------------------------------------
+
+    static int const                        MaxSignificantDigits = 19;
+    static int const                        MaxExponent = 100000;
+
+    char const * const                      pEnd(pBuffer + cBuffer);
+
+    pBuffer = SkipWhitespace(pBuffer, pEnd);
+
+    bool                                    isNegative(false);
+
+    if(pBuffer != pEnd && (*pBuffer == '-' || *pBuffer == '+')) {
+        isNegative = *pBuffer == '-';
+        ++pBuffer;
+    }
+
+    // Special values
+    if(pBuffer != pEnd && (*pBuffer == 'n' || *pBuffer == 'N' || *pBuffer == 'i' || *pBuffer == 'I')) {
+        char const *                        pKeywordEnd(nullptr);
+        T                                   result(0);
+
+        if((pKeywordEnd = MatchKeyword(pBuffer, pEnd, "nan")) != nullptr)
+            result = std::numeric_limits<T>::quiet_NaN();
+        else if(
+            (pKeywordEnd = MatchKeyword(pBuffer, pEnd, "infinity")) != nullptr
+            || (pKeywordEnd = MatchKeyword(pBuffer, pEnd, "inf")) != nullptr
+        )
+            result = std::numeric_limits<T>::infinity();
+
+        if(pKeywordEnd == nullptr || IsValidEnd(pKeywordEnd, pEnd) == false)
+            return ParseResult::Invalid;
+
+        value = isNegative ? -result : result;
+        return ParseResult::Success;
+    }
+
+    // Mantissa
+    char const * const                      pDigits(pBuffer);
+    std::uint64_t                           mantissa(0);
+    int                                     numSignificantDigits(0);
+    int                                     decimalExponent(0);
+    bool                                    hasDigits(false);
+    bool                                    isTruncated(false);
+
+    while(pBuffer != pEnd && IsDigit(*pBuffer)) {
+        hasDigits = true;
+
+        if(numSignificantDigits < MaxSignificantDigits) {
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(*pBuffer - '0');
+
+            if(mantissa != 0)
+                ++numSignificantDigits;
+        }
+        else {
+            isTruncated = true;
+            ++decimalExponent;
+        }
+
+        ++pBuffer;
+    }
+
+    if(pBuffer != pEnd && *pBuffer == '.') {
+        ++pBuffer;
+
+        while(pBuffer != pEnd && IsDigit(*pBuffer)) {
+            hasDigits = true;
+
+            if(numSignificantDigits < MaxSignificantDigits) {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>(*pBuffer - '0');
+
+                if(mantissa != 0)
+                    ++numSignificantDigits;
+
+                --decimalExponent;
+            }
+            else
+                isTruncated = true;
+
+            ++pBuffer;
+        }
+    }
+
+    if(hasDigits == false)
+        return ParseResult::Invalid;
+
+    char const * const                      pDigitsEnd(pBuffer);
+
+    // Exponent
+    int                                     exponent(0);
+
+    if(pBuffer != pEnd && (*pBuffer == 'e' || *pBuffer == 'E')) {
+        ++pBuffer;
+
+        bool                                isNegativeExponent(false);
+
+        if(pBuffer != pEnd && (*pBuffer == '-' || *pBuffer == '+')) {
+            isNegativeExponent = *pBuffer == '-';
+            ++pBuffer;
+        }
+
+        if(pBuffer == pEnd || IsDigit(*pBuffer) == false)
+            return ParseResult::Invalid;
+
+        while(pBuffer != pEnd && IsDigit(*pBuffer)) {
+            // Values this large are either 0 or infinity; clamp to prevent overflow
+            if(exponent < MaxExponent)
+                exponent = exponent * 10 + (*pBuffer - '0');
+
+            ++pBuffer;
+        }
+
+        if(isNegativeExponent)
+            exponent = -exponent;
+    }
+
+    if(IsValidEnd(pBuffer, pEnd) == false)
+        return ParseResult::Invalid;
+
+    // Fast path
+    if(isTruncated == false) {
+        int const                           pow10(decimalExponent + exponent);
+
+        if(mantissa == 0) {
+            value = isNegative ? -static_cast<T>(0) : static_cast<T>(0);
+            return ParseResult::Success;
+        }
+
+        if(
+            mantissa <= (static_cast<std::uint64_t>(1) << std::numeric_limits<T>::digits)
+            && pow10 >= -Info::MaxExactPow10
+            && pow10 <= Info::MaxExactPow10
+        ) {
+            T                               result(static_cast<T>(mantissa));
+
+            if(pow10 < 0)
+                result /= Pow10<T>(-pow10);
+            else
+                result *= Pow10<T>(pow10);
+
+            value = isNegative ? -result : result;
+            return ParseResult::Success;
+        }
+    }
+
+    // Exact fallback; normalize the text to "[-]digitse<exponent>", which doesn't
+    // contain any locale-specific characters.
+    std::string                             normalized;
+
+    normalized.reserve(static_cast<size_t>(pDigitsEnd - pDigits) + 16);
+
+    if(isNegative)
+        normalized += '-';
+
+    int                                     numFractionalDigits(0);
+    bool                                    isFractional(false);
+
+    for(char const *pDigit = pDigits; pDigit != pDigitsEnd; ++pDigit) {
+        if(*pDigit == '.') {
+            isFractional = true;
+            continue;
+        }
+
+        normalized += *pDigit;
+
+        if(isFractional)
+            ++numFractionalDigits;
+    }
+
+    normalized += 'e';
+    normalized += std::to_string(exponent - numFractionalDigits);
+
+    T const                                 result(Info::StrTo(normalized.c_str()));
+
+    if(std::isinf(result))
+        return ParseResult::OutOfRange;
+
+    value = result;
+    return ParseResult::Success;
+}
+
+} // namespace Details
+
+template <typename T>
+ParseResult TryParse(char const *pBuffer, size_t cBuffer, T &value) {
+    static_assert(std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false, "Numeric types are required");
+
+    if(pBuffer == nullptr && cBuffer != 0)
+        throw std::invalid_argument("pBuffer");
+
+    return Details::TryParseImpl(pBuffer, cBuffer, value, std::integral_constant<bool, std::is_integral<T>::value>());
+}
+
+template <typename T>
+T Parse(char const *pBuffer, size_t cBuffer) {
+    T                                       result(0);
+
+    if(TryParse(pBuffer, cBuffer, result) != ParseResult::Success)
+        throw std::invalid_argument("Invalid conversion");
+
+    return result;
+}
+
+template <typename T>
+void ParseBatch(char const *pBytes, size_t const *pOffsets, size_t cItems, T *pOutput) {
+    if(cItems == 0)
+        return;
+
+    if(pOffsets == nullptr)
+        throw std::invalid_argument("pOffsets");
+    if(pBytes == nullptr && pOffsets[cItems] != pOffsets[0])
+        throw std::invalid_argument("pBytes");
+    if(pOutput == nullptr)
+        throw std::invalid_argument("pOutput");
+
+    size_t const * const                    pOffsetsEnd(pOffsets + cItems);
+
+    while(pOffsets != pOffsetsEnd) {
+        if(pOffsets[1] < pOffsets[0])
+            throw std::invalid_argument("pOffsets");
+
+        *pOutput++ = Parse<T>(pBytes + pOffsets[0], pOffsets[1] - pOffsets[0]);
+        ++pOffsets;
+    }
+}
+
+} // namespace NumberParsing
+} // namespace Featurizer
+} // namespace Microsoft
@@ -118,3 +118,63 @@ TEST_CASE("GetSupportedCountries") {
     CHECK(DateTimeFeaturizer_DestroyStringBuffers(pStringBuffers, numStringBuffers, &pErrorInfo));
     CHECK(pErrorInfo == nullptr);
 }
+
+TEST_CASE("TransformBatch") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    DateTimeFeaturizer_EstimatorHandle *    pEstimatorHandle(nullptr);
+    DateTimeFeaturizer_TransformerHandle *  pTransformerHandle(nullptr);
+
+    REQUIRE(DateTimeFeaturizer_CreateEstimator("Canada", nullptr, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(DateTimeFeaturizer_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(DateTimeFeaturizer_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::vector<int64_t> const              inputs{1751241600, 217081625, 157161650};
+    std::vector<int32_t>                    year(inputs.size());
+    std::vector<uint8_t>                    month(inputs.size());
+    std::vector<uint8_t>                    monthLabel(inputs.size());
+    std::vector<uint16_t>                   holidayName(inputs.size());
+
+    DateTimeFeaturizer_TimePointColumns     columns;
+
+    memset(&columns, 0, sizeof(columns));
+
+    columns.year = year.data();
+    columns.month = month.data();
+    columns.monthLabel = monthLabel.data();
+    columns.holidayName = holidayName.data();
+
+    CHECK(DateTimeFeaturizer_TransformBatch(pTransformerHandle, inputs.data(), inputs.size(), &columns, &pErrorInfo));
+    CHECK(pErrorInfo == nullptr);
+
+    CHECK(year == std::vector<int32_t>{2025, 1976, 1974});
+    CHECK(month == std::vector<uint8_t>{6, 11, 12});
+    CHECK(holidayName[0] == 0);
+    CHECK(holidayName[1] == 0);
+    CHECK(holidayName[2] != 0);
+
+    char const *                            pString(nullptr);
+    size_t                                  cCharacters(0);
+
+    CHECK(DateTimeFeaturizer_GetLabel(DateTimeFeaturizer_MonthLabel, monthLabel[1], &pString, &cCharacters, &pErrorInfo));
+    CHECK(pErrorInfo == nullptr);
+    CHECK(std::string(pString, cCharacters) == "November");
+
+    CHECK(DateTimeFeaturizer_GetHolidayName(pTransformerHandle, holidayName[2], &pString, &cCharacters, &pErrorInfo));
+    CHECK(pErrorInfo == nullptr);
+    CHECK(std::string(pString, cCharacters) == "Christmas Day");
+
+    CHECK(DateTimeFeaturizer_GetLabel(DateTimeFeaturizer_AmPmLabel, 2, &pString, &cCharacters, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    CHECK(DestroyErrorInfo(pErrorInfo));
+
+    CHECK(DateTimeFeaturizer_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    CHECK(pErrorInfo == nullptr);
+
+    CHECK(DateTimeFeaturizer_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    CHECK(pErrorInfo == nullptr);
+}
@@ -172,4 +172,118 @@ FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_DestroyStringBuffers(/*in*/ Strin
     }
 }
 
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_TransformBatch(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ int64_t const *pInputs, /*in*/ std::size_t cInputs, /*in*/ DateTimeFeaturizer_TimePointColumns const *pColumns, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pInputs == nullptr && cInputs != 0) throw std::invalid_argument("'pInputs' is null");
+        if(pColumns == nullptr) throw std::invalid_argument("'pColumns' is null");
+
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::TimePointColumns    columns;
+
+        columns.pYear = pColumns->year;
+        columns.pMonth = pColumns->month;
+        columns.pDay = pColumns->day;
+        columns.pHour = pColumns->hour;
+        columns.pMinute = pColumns->minute;
+        columns.pSecond = pColumns->second;
+        columns.pAmPm = pColumns->amPm;
+        columns.pHour12 = pColumns->hour12;
+        columns.pDayOfWeek = pColumns->dayOfWeek;
+        columns.pDayOfQuarter = pColumns->dayOfQuarter;
+        columns.pDayOfYear = pColumns->dayOfYear;
+        columns.pWeekOfMonth = pColumns->weekOfMonth;
+        columns.pQuarterOfYear = pColumns->quarterOfYear;
+        columns.pHalfOfYear = pColumns->halfOfYear;
+        columns.pWeekIso = pColumns->weekIso;
+        columns.pYearIso = pColumns->yearIso;
+        columns.pMonthLabel = pColumns->monthLabel;
+        columns.pAmPmLabel = pColumns->amPmLabel;
+        columns.pDayOfWeekLabel = pColumns->dayOfWeekLabel;
+        columns.pHolidayName = pColumns->holidayName;
+        columns.pIsPaidTimeOff = pColumns->isPaidTimeOff;
+
+        transformer.execute_batch(pInputs, cInputs, columns);
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_GetLabel(/*in*/ DateTimeFeaturizer_LabelType labelType, /*in*/ uint8_t code, /*out*/ char const **ppLabel, /*out*/ std::size_t *pNumCharacters, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(ppLabel == nullptr) throw std::invalid_argument("'ppLabel' is null");
+        if(pNumCharacters == nullptr) throw std::invalid_argument("'pNumCharacters' is null");
+
+        using TimePoint                     = Microsoft::Featurizer::Featurizers::TimePoint;
+
+        Microsoft::Featurizer::Featurizers::StringView const *  pLabels(nullptr);
+        size_t                              cLabels(0);
+
+        if(labelType == DateTimeFeaturizer_MonthLabel) {
+            pLabels = TimePoint::MonthLabels;
+            cLabels = sizeof(TimePoint::MonthLabels) / sizeof(*TimePoint::MonthLabels);
+        }
+        else if(labelType == DateTimeFeaturizer_AmPmLabel) {
+            pLabels = TimePoint::AmPmLabels;
+            cLabels = sizeof(TimePoint::AmPmLabels) / sizeof(*TimePoint::AmPmLabels);
+        }
+        else if(labelType == DateTimeFeaturizer_DayOfWeekLabel) {
+            pLabels = TimePoint::WeekDayLabels;
+            cLabels = sizeof(TimePoint::WeekDayLabels) / sizeof(*TimePoint::WeekDayLabels);
+        }
+        else
+            throw std::invalid_argument("'labelType' is invalid");
+
+        if(code >= cLabels) throw std::invalid_argument("'code' is invalid");
+
+        *ppLabel = pLabels[code].data();
+        *pNumCharacters = pLabels[code].size();
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_GetHolidayName(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ uint16_t holidayId, /*out*/ char const **ppName, /*out*/ std::size_t *pNumCharacters, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppName == nullptr) throw std::invalid_argument("'ppName' is null");
+        if(pNumCharacters == nullptr) throw std::invalid_argument("'pNumCharacters' is null");
+
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType const & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::StringView const    name(transformer.GetHolidayName(holidayId));
+
+        *ppName = name.data();
+        *pNumCharacters = name.size();
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 } // extern "C"
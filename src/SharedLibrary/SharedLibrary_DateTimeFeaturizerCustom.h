@@ -18,12 +18,59 @@ struct StringBuffer {
     std::size_t cCharacters;
 } FEATURIZER_LIBRARY_API_PACK_INLINE;
 
+/* Output of DateTimeFeaturizer_TransformBatch; there is one column for each
+   TimePoint field. Each non-null pointer must reference a buffer with at least
+   `cInputs` elements; null columns are not populated.
+
+   Labels are written as codes that can be passed to DateTimeFeaturizer_GetLabel.
+   Holidays are written as ids that can be passed to DateTimeFeaturizer_GetHolidayName,
+   where 0 means that the date is not a holiday. */
+struct DateTimeFeaturizer_TimePointColumns {
+    /*out*/ int32_t * year;
+    /*out*/ uint8_t * month;
+    /*out*/ uint8_t * day;
+    /*out*/ uint8_t * hour;
+    /*out*/ uint8_t * minute;
+    /*out*/ uint8_t * second;
+    /*out*/ uint8_t * amPm;
+    /*out*/ uint8_t * hour12;
+    /*out*/ uint8_t * dayOfWeek;
+    /*out*/ uint8_t * dayOfQuarter;
+    /*out*/ uint16_t * dayOfYear;
+    /*out*/ uint16_t * weekOfMonth;
+    /*out*/ uint8_t * quarterOfYear;
+    /*out*/ uint8_t * halfOfYear;
+    /*out*/ uint8_t * weekIso;
+    /*out*/ int32_t * yearIso;
+    /*out*/ uint8_t * monthLabel;
+    /*out*/ uint8_t * amPmLabel;
+    /*out*/ uint8_t * dayOfWeekLabel;
+    /*out*/ uint16_t * holidayName;
+    /*out*/ uint8_t * isPaidTimeOff;
+} FEATURIZER_LIBRARY_API_PACK_INLINE;
+
 FEATURIZER_LIBRARY_API_PACK_SUFFIX
 
+enum DateTimeFeaturizer_LabelTypeValue {
+    DateTimeFeaturizer_MonthLabel = 1,
+    DateTimeFeaturizer_AmPmLabel,
+    DateTimeFeaturizer_DayOfWeekLabel
+};
+
+typedef unsigned char DateTimeFeaturizer_LabelType;
+
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerFromSavedDataWithDataRoot(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*in*/ char const *dataRootDir, /*out*/ DateTimeFeaturizer_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_IsValidCountry(/*in*/ char const *countryName, /*in*/ char const *optionalDataRootDir, /*out*/ bool *isValid, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_GetSupportedCountries(/*in*/ char const *optionalDataRootDir, /*out*/ StringBuffer ** ppStringBuffers, /*out*/ std::size_t * pNumStringBuffers, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_DestroyStringBuffers(/*in*/ StringBuffer *pStringBuffer, /*in*/ std::size_t numStringBuffers, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
+/* Transforms `cInputs` values (seconds since the epoch) into columns without allocating memory */
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_TransformBatch(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ int64_t const *pInputs, /*in*/ std::size_t cInputs, /*in*/ DateTimeFeaturizer_TimePointColumns const *pColumns, /*out*/ ErrorInfoHandle **ppErrorInfo);
+
+/* The strings returned by these functions are owned by the library and must not be destroyed;
+   holiday names are valid for the lifetime of the transformer. */
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_GetLabel(/*in*/ DateTimeFeaturizer_LabelType labelType, /*in*/ uint8_t code, /*out*/ char const **ppLabel, /*out*/ std::size_t *pNumCharacters, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_GetHolidayName(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ uint16_t holidayId, /*out*/ char const **ppName, /*out*/ std::size_t *pNumCharacters, /*out*/ ErrorInfoHandle **ppErrorInfo);
+
 } // extern "C"
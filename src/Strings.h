@@ -6,6 +6,7 @@
 
 #include<algorithm>
 #include<functional>
+#include<iterator>
 #include<regex>
 #include<string>
 #include<vector>
@@ -241,12 +242,15 @@ void ParseNgramCharHelper(IteratorT const &begin,
                           size_t const ngramRangeMax,
                           std::function<void (IteratorT, IteratorT)> const &callback) {
 
-    std::vector<IteratorT> wordIterVector(IteratorVectorGenerator(begin, end));
+    // The iterators are calculated on the fly (rather than cached in a vector)
+    // so that this function doesn't allocate memory.
+    size_t const                            numChars(static_cast<size_t>(std::distance(begin, end)));
+    IteratorT                               strIter(begin);
 
-    for (size_t strIterOffset = 0; strIterOffset < wordIterVector.size(); ++strIterOffset)  {
+    for (size_t strIterOffset = 0; strIterOffset < numChars; ++strIterOffset, ++strIter)  {
         for (size_t ngramRangeVal = ngramRangeMin; ngramRangeVal <= ngramRangeMax; ++ngramRangeVal) {
-            if (strIterOffset + ngramRangeVal < wordIterVector.size()) {
-                callback(wordIterVector[strIterOffset], wordIterVector[strIterOffset + ngramRangeVal]);
+            if (strIterOffset + ngramRangeVal <= numChars) {
+                callback(strIter, std::next(strIter, static_cast<typename std::iterator_traits<IteratorT>::difference_type>(ngramRangeVal)));
                 break;
             }
         }
@@ -55,6 +55,9 @@
 
 #include "3rdParty/optional.h"
 
+#include "NumberFormatting.h"
+#include "NumberParsing.h"
+
 namespace Microsoft {
 namespace Featurizer {
 
@@ -320,16 +323,13 @@ struct Traits<bool> : public TraitsImpl<bool> {
 template <>
 struct Traits<std::int8_t> : public TraitsImpl<std::int8_t> {
     static std::string ToString(std::int8_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::int8_t FromString(std::string const &value) {
-        int                                 v(std::stoi(value.c_str()));
-
-        if(v < std::numeric_limits<std::int8_t>::min() || v > std::numeric_limits<std::int8_t>::max())
-            throw std::invalid_argument("Invalid conversion");
-
-        return static_cast<std::int8_t>(v);
+        return NumberParsing::Parse<std::int8_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -350,16 +350,13 @@ struct Traits<std::int8_t> : public TraitsImpl<std::int8_t> {
 template <>
 struct Traits<std::int16_t> : public TraitsImpl<std::int16_t> {
     static std::string ToString(std::int16_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::int16_t FromString(std::string const &value) {
-        int                                 v(std::stoi(value.c_str()));
-
-        if(v < std::numeric_limits<std::int16_t>::min() || v > std::numeric_limits<std::int16_t>::max())
-            throw std::invalid_argument("Invalid conversion");
-
-        return static_cast<std::int16_t>(v);
+        return NumberParsing::Parse<std::int16_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -380,12 +377,13 @@ struct Traits<std::int16_t> : public TraitsImpl<std::int16_t> {
 template <>
 struct Traits<std::int32_t> : public TraitsImpl<std::int32_t> {
     static std::string ToString(std::int32_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::int32_t FromString(std::string const &value) {
-        static_assert(sizeof(std::int32_t) == sizeof(int), "This code expects that an int is 32 bits");
-        return std::stoi(value.c_str());
+        return NumberParsing::Parse<std::int32_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -406,34 +404,13 @@ struct Traits<std::int32_t> : public TraitsImpl<std::int32_t> {
 template <>
 struct Traits<std::int64_t> : public TraitsImpl<std::int64_t> {
     static std::string ToString(std::int64_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::int64_t FromString(std::string const &value) {
-        static_assert(sizeof(std::int64_t) <= sizeof(long long), "This code expects that long long >= 64 bits");
-
-        long long                           v(std::stoll(value.c_str()));
-
-#if (defined __clang__)
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wtautological-type-limit-compare"
-#elif (defined _MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable: 4127) // Conditional expression is constant
-#endif
-
-        if(sizeof(long long) > sizeof(std::int64_t)) {
-            if(v < std::numeric_limits<std::int64_t>::min() || v > std::numeric_limits<std::int64_t>::max())
-                throw std::invalid_argument("Invalid conversion");
-        }
-
-#if (defined __clang__)
-#   pragma clang diagnostic pop
-#elif (defined _MSC_VER)
-#   pragma warning(pop)
-#endif
-
-        return static_cast<std::int64_t>(v);
+        return NumberParsing::Parse<std::int64_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -454,16 +431,13 @@ struct Traits<std::int64_t> : public TraitsImpl<std::int64_t> {
 template <>
 struct Traits<std::uint8_t> : public TraitsImpl<std::uint8_t> {
     static std::string ToString(std::uint8_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::uint8_t FromString(std::string const &value) {
-        unsigned long                       v(std::stoul(value.c_str()));
-
-        if(v > std::numeric_limits<std::uint8_t>::max())
-            throw std::invalid_argument("Invalid conversion");
-
-        return static_cast<std::uint8_t>(v);
+        return NumberParsing::Parse<std::uint8_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -484,16 +458,13 @@ struct Traits<std::uint8_t> : public TraitsImpl<std::uint8_t> {
 template <>
 struct Traits<std::uint16_t> : public TraitsImpl<std::uint16_t> {
     static std::string ToString(std::uint16_t const& value) {
-         return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::uint16_t FromString(std::string const &value) {
-        unsigned long                       v(std::stoul(value.c_str()));
-
-        if(v > std::numeric_limits<std::uint16_t>::max())
-            throw std::invalid_argument("Invalid conversion");
-
-        return static_cast<std::uint16_t>(v);
+        return NumberParsing::Parse<std::uint16_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -514,34 +485,13 @@ struct Traits<std::uint16_t> : public TraitsImpl<std::uint16_t> {
 template <>
 struct Traits<std::uint32_t> : public TraitsImpl<std::uint32_t> {
     static std::string ToString(std::uint32_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::uint32_t FromString(std::string const &value) {
-        static_assert(sizeof(std::uint32_t) <= sizeof(unsigned long), "This code assumes that a long is more 32 bits");
-
-        unsigned long                       v(std::stoul(value.c_str()));
-
-#if (defined __clang__)
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wtautological-type-limit-compare"
-#elif (defined _MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable: 4127) // Conditional expression is constant
-#endif
-
-        if(sizeof(unsigned long) > sizeof(std::uint32_t)) {
-            if(v > std::numeric_limits<std::uint32_t>::max())
-                throw std::invalid_argument("Invalid conversion");
-        }
-
-#if (defined __clang__)
-#   pragma clang diagnostic pop
-#elif (defined _MSC_VER)
-#   pragma warning(pop)
-#endif
-
-        return static_cast<std::uint32_t>(v);
+        return NumberParsing::Parse<std::uint32_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -562,34 +512,13 @@ struct Traits<std::uint32_t> : public TraitsImpl<std::uint32_t> {
 template <>
 struct Traits<std::uint64_t> : public TraitsImpl<std::uint64_t> {
     static std::string ToString(std::uint64_t const& value) {
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxIntegerChars];
+
+        return std::string(buffer, NumberFormatting::FormatInteger(value, buffer));
     }
 
     static std::uint64_t FromString(std::string const &value) {
-        static_assert(sizeof(std::uint64_t) <= sizeof(unsigned long long), "This code expects that unsigned long long >= 64 bits");
-
-        unsigned long long                  v(std::stoull(value.c_str()));
-
-#if (defined __clang__)
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wtautological-type-limit-compare"
-#elif (defined _MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable: 4127) // Conditional expression is constant
-#endif
-
-        if(sizeof(unsigned long long) > sizeof(std::uint64_t)) {
-            if(v > std::numeric_limits<std::uint64_t>::max())
-                throw std::invalid_argument("Invalid conversion");
-        }
-
-#if (defined __clang__)
-#   pragma clang diagnostic pop
-#elif (defined _MSC_VER)
-#   pragma warning(pop)
-#endif
-
-        return static_cast<std::uint64_t>(v);
+        return NumberParsing::Parse<std::uint64_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -660,14 +589,13 @@ struct Traits<std::float_t> {
             return "NaN";
         }
 
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxFixedChars];
+
+        return std::string(buffer, NumberFormatting::FormatFixed(value, buffer));
     }
 
     static std::float_t FromString(std::string const &value) {
-        if(value == "NaN")
-            return std::numeric_limits<std::float_t>::quiet_NaN();
-
-        return std::stof(value.c_str());
+        return NumberParsing::Parse<std::float_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -738,14 +666,13 @@ struct Traits<std::double_t>  {
             return "NaN";
         }
 
-        return std::to_string(value);
+        char                                buffer[NumberFormatting::MaxFixedChars];
+
+        return std::string(buffer, NumberFormatting::FormatFixed(value, buffer));
     }
 
     static std::double_t FromString(std::string const &value) {
-        if(value == "NaN")
-            return std::numeric_limits<std::double_t>::quiet_NaN();
-
-        return std::stod(value.c_str());
+        return NumberParsing::Parse<std::double_t>(value.data(), value.size());
     }
 
     struct IsIntOrNumeric {
@@ -804,23 +731,22 @@ namespace {
 
 template <typename T>
 std::string ToStringImpl(T const *pBuffer, size_t cBuffer) {
-    std::ostringstream streamObj;
-
-    streamObj << "[";
+    std::string                             result("[");
 
     if(cBuffer != 0) {
         T const * const                     pNextToLastElement(pBuffer + cBuffer - 1);
 
         while(pBuffer != pNextToLastElement) {
-            streamObj << Traits<T>::ToString(*pBuffer) << ",";
+            result += Traits<T>::ToString(*pBuffer);
+            result += ',';
             ++pBuffer;
         }
 
-        streamObj << Traits<T>::ToString(*pBuffer);
+        result += Traits<T>::ToString(*pBuffer);
     }
 
-    streamObj << "]";
-    return streamObj.str();
+    result += ']';
+    return result;
 }
 
 } // anonymous namespace
@@ -29,6 +29,7 @@ TEST_CASE("Invalid Mode - Serialization") {
     CHECK_THROWS_WITH(archive.deserialize<int>(), "Invalid mode");
     CHECK_THROWS_WITH(archive.get_buffer_ptr(), "Invalid mode");
     CHECK_THROWS_WITH(archive.update_buffer_ptr(10), "Invalid mode");
+    CHECK_THROWS_WITH(archive.get_remaining_size(), "Invalid mode");
     CHECK_THROWS_WITH(archive.AtEnd(), "Invalid mode");
 }
 
@@ -59,10 +60,14 @@ TEST_CASE("Roundtrip") {
     out.serialize(static_cast<double>(2.0));
 
     NS::Archive                             in(out.commit());
+
+    CHECK(in.get_remaining_size() == sizeof(bool) + sizeof(int) + sizeof(double));
+
     bool const                              one(in.deserialize<bool>());
     int const                               two(in.deserialize<int>());
     double const                            three(in.deserialize<double>());
 
+    CHECK(in.get_remaining_size() == 0);
     CHECK(in.AtEnd());
     CHECK(one == true);
     CHECK(two == 10);
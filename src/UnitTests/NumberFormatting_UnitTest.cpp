@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <random>
+
+#include "../NumberFormatting.h"
+
+namespace NS = Microsoft::Featurizer;
+
+template <typename T>
+std::string FormatInteger(T value) {
+    char                                    buffer[NS::NumberFormatting::MaxIntegerChars];
+
+    return std::string(buffer, NS::NumberFormatting::FormatInteger(value, buffer));
+}
+
+template <typename T>
+std::string FormatFixed(T value) {
+    char                                    buffer[NS::NumberFormatting::MaxFixedChars];
+
+    return std::string(buffer, NS::NumberFormatting::FormatFixed(value, buffer));
+}
+
+template <typename T>
+void IntegerTest(void) {
+    CHECK(FormatInteger(static_cast<T>(0)) == "0");
+    CHECK(FormatInteger(std::numeric_limits<T>::min()) == std::to_string(std::numeric_limits<T>::min()));
+    CHECK(FormatInteger(std::numeric_limits<T>::max()) == std::to_string(std::numeric_limits<T>::max()));
+
+    T                                       value(1);
+
+    while(true) {
+        CHECK(FormatInteger(value) == std::to_string(value));
+        CHECK(FormatInteger(static_cast<T>(value - 1)) == std::to_string(static_cast<T>(value - 1)));
+
+        if(std::is_signed<T>::value)
+            CHECK(FormatInteger(static_cast<T>(-value)) == std::to_string(static_cast<T>(-value)));
+
+        if(value > std::numeric_limits<T>::max() / 10)
+            break;
+
+        value = static_cast<T>(value * 10);
+    }
+}
+
+TEST_CASE("FormatInteger") {
+    IntegerTest<std::int8_t>();
+    IntegerTest<std::int16_t>();
+    IntegerTest<std::int32_t>();
+    IntegerTest<std::int64_t>();
+    IntegerTest<std::uint8_t>();
+    IntegerTest<std::uint16_t>();
+    IntegerTest<std::uint32_t>();
+    IntegerTest<std::uint64_t>();
+
+    CHECK(FormatInteger(static_cast<std::int8_t>(-20)) == "-20");
+    CHECK(FormatInteger(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+    CHECK(FormatInteger(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+}
+
+TEST_CASE("FormatFixed") {
+    CHECK(FormatFixed(0.0) == "0.000000");
+    CHECK(FormatFixed(-0.0) == std::to_string(-0.0));
+    CHECK(FormatFixed(123.0f) == "123.000000");
+    CHECK(FormatFixed(15.5) == "15.500000");
+    CHECK(FormatFixed(0.147) == "0.147000");
+    CHECK(FormatFixed(135453984983490.5473) == "135453984983490.546875");
+    CHECK(FormatFixed(1e300) == std::to_string(1e300));
+    CHECK(FormatFixed(-std::numeric_limits<double>::max()) == std::to_string(-std::numeric_limits<double>::max()));
+    CHECK(FormatFixed(std::numeric_limits<double>::infinity()) == std::to_string(std::numeric_limits<double>::infinity()));
+
+    // Values with more than 6 fractional digits
+    CHECK(FormatFixed(2.0 / 3.0) == "0.666667");
+    CHECK(FormatFixed(0.0000005) == std::to_string(0.0000005));
+    CHECK(FormatFixed(1e-7) == "0.000000");
+    CHECK(FormatFixed(4294967295.75) == "4294967295.750000");
+}
+
+TEST_CASE("FormatFixed - consistency with std::to_string") {
+    std::mt19937_64                         generator(67890);
+    std::uniform_real_distribution<double>  wide(-1e10, 1e10);
+    std::uniform_int_distribution<int>      decimals(0, 8);
+
+    for(int i = 0; i < 100000; ++i) {
+        // Values with few decimal places are the most common and exercise the fast path
+        double const                        scale(std::pow(10.0, decimals(generator)));
+        double const                        dValue(std::round(wide(generator) / 1e4 * scale) / scale);
+        float const                         fValue(static_cast<float>(dValue));
+
+        REQUIRE(FormatFixed(dValue) == std::to_string(dValue));
+        REQUIRE(FormatFixed(fValue) == std::to_string(fValue));
+
+        double const                        wideValue(wide(generator));
+
+        REQUIRE(FormatFixed(wideValue) == std::to_string(wideValue));
+    }
+}
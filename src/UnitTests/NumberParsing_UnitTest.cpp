@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../NumberParsing.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using NS::NumberParsing::ParseResult;
+
+template <typename T>
+ParseResult TryParse(std::string const &input, T &value) {
+    return NS::NumberParsing::TryParse(input.data(), input.size(), value);
+}
+
+template <typename T>
+T Parse(std::string const &input) {
+    return NS::NumberParsing::Parse<T>(input.data(), input.size());
+}
+
+template <typename T>
+void IntegerTest(void) {
+    T                                       value(0);
+
+    CHECK(Parse<T>("0") == 0);
+    CHECK(Parse<T>("-0") == 0);
+    CHECK(Parse<T>(std::to_string(std::numeric_limits<T>::max())) == std::numeric_limits<T>::max());
+    CHECK(Parse<T>(std::to_string(std::numeric_limits<T>::min())) == std::numeric_limits<T>::min());
+
+    // One past the limits
+    std::string                             tooLarge(std::to_string(std::numeric_limits<T>::max()));
+
+    ++tooLarge.back();
+    CHECK(TryParse(tooLarge, value) == ParseResult::OutOfRange);
+    CHECK(TryParse(tooLarge + "0", value) == ParseResult::OutOfRange);
+
+    if(std::is_signed<T>::value) {
+        std::string                         tooSmall(std::to_string(std::numeric_limits<T>::min()));
+
+        ++tooSmall.back();
+        CHECK(TryParse(tooSmall, value) == ParseResult::OutOfRange);
+    }
+    else
+        CHECK(TryParse(std::string("-1"), value) == ParseResult::OutOfRange);
+
+    CHECK(TryParse(std::string("1.0"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("1e3"), value) == ParseResult::Invalid);
+}
+
+TEST_CASE("Integers") {
+    IntegerTest<std::int8_t>();
+    IntegerTest<std::int16_t>();
+    IntegerTest<std::int32_t>();
+    IntegerTest<std::int64_t>();
+    IntegerTest<std::uint8_t>();
+    IntegerTest<std::uint16_t>();
+    IntegerTest<std::uint32_t>();
+    IntegerTest<std::uint64_t>();
+
+    CHECK(Parse<int>("  +123\t") == 123);
+    CHECK(Parse<int>("-0042") == -42);
+    CHECK_THROWS_WITH(Parse<int>("12 3"), "Invalid conversion");
+    CHECK_THROWS_WITH(Parse<int>("0x10"), "Invalid conversion");
+
+    int                                     value(7);
+
+    CHECK(TryParse(std::string(""), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("  "), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("-"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("abc"), value) == ParseResult::Invalid);
+    CHECK(value == 7);
+}
+
+TEST_CASE("Not null-terminated") {
+    char const                              buffer[] = { '1', '2', '3', '4' };
+
+    CHECK(NS::NumberParsing::Parse<int>(buffer, 2) == 12);
+    CHECK(NS::NumberParsing::Parse<double>(buffer + 1, 3) == 234.0);
+    CHECK_THROWS_WITH(NS::NumberParsing::Parse<int>(buffer, 0), "Invalid conversion");
+}
+
+TEST_CASE("Floating point") {
+    CHECK(Parse<double>("0") == 0.0);
+    CHECK(std::signbit(Parse<double>("-0.0")));
+    CHECK(Parse<double>("1") == 1.0);
+    CHECK(Parse<double>("1.") == 1.0);
+    CHECK(Parse<double>(".5") == 0.5);
+    CHECK(Parse<double>("+1.25") == 1.25);
+    CHECK(Parse<double>("-123.456") == -123.456);
+    CHECK(Parse<double>(" 1e10 ") == 1e10);
+    CHECK(Parse<double>("1E-10") == 1e-10);
+    CHECK(Parse<double>("0.000000000000000000000000000001") == 1e-30);
+    CHECK(Parse<double>("123456789012345678901234567890") == 123456789012345678901234567890.0);
+    CHECK(Parse<double>("1.7976931348623157e308") == std::numeric_limits<double>::max());
+    CHECK(Parse<double>("4.9406564584124654e-324") == std::numeric_limits<double>::denorm_min());
+    CHECK(Parse<double>("1e-400") == 0.0);
+    CHECK(Parse<float>("0.12345") == 0.12345f);
+    CHECK(Parse<float>("3.4028235e38") == std::numeric_limits<float>::max());
+
+    CHECK(std::isnan(Parse<double>("NaN")));
+    CHECK(std::isnan(Parse<float>("nan")));
+    CHECK(Parse<double>("inf") == std::numeric_limits<double>::infinity());
+    CHECK(Parse<double>("-Infinity") == -std::numeric_limits<double>::infinity());
+
+    double                                  value(0);
+    float                                   fValue(0);
+
+    CHECK(TryParse(std::string("1e400"), value) == ParseResult::OutOfRange);
+    CHECK(TryParse(std::string("3.5e38"), fValue) == ParseResult::OutOfRange);
+    CHECK(TryParse(std::string("."), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("1e"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("1e+"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("1.2.3"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("1,5"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("infinite"), value) == ParseResult::Invalid);
+    CHECK(TryParse(std::string("this is not valid"), value) == ParseResult::Invalid);
+}
+
+TEST_CASE("Floating point - consistency with strtod") {
+    std::mt19937_64                         generator(24680);
+    std::uniform_int_distribution<int>      decimals(0, 8);
+    std::uniform_real_distribution<double>  values(-1e6, 1e6);
+
+    char                                    buffer[64];
+
+    for(int i = 0; i < 100000; ++i) {
+        // Arbitrary bit patterns (mostly exercises the fallback)
+        std::uint64_t const                 bits(generator());
+        double                              dValue;
+
+        std::memcpy(&dValue, &bits, sizeof(dValue));
+
+        if(std::isfinite(dValue)) {
+            int const                       length(std::snprintf(buffer, sizeof(buffer), "%.17g", dValue));
+
+            REQUIRE(NS::NumberParsing::Parse<double>(buffer, static_cast<size_t>(length)) == dValue);
+
+            float const                     fValue(static_cast<float>(dValue));
+
+            if(std::isfinite(fValue)) {
+                int const                   fLength(std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(fValue)));
+
+                REQUIRE(NS::NumberParsing::Parse<float>(buffer, static_cast<size_t>(fLength)) == fValue);
+            }
+        }
+
+        // Decimal values (mostly exercises the fast path)
+        int const                           length(std::snprintf(buffer, sizeof(buffer), "%.*f", decimals(generator), values(generator)));
+
+        REQUIRE(NS::NumberParsing::Parse<double>(buffer, static_cast<size_t>(length)) == std::strtod(buffer, nullptr));
+        REQUIRE(NS::NumberParsing::Parse<float>(buffer, static_cast<size_t>(length)) == std::strtof(buffer, nullptr));
+    }
+}
+
+TEST_CASE("ParseBatch") {
+    std::string const                       bytes("1.5-2 3e2NaN");
+    std::vector<size_t> const               offsets{ 0, 3, 5, 9, 12 };
+    std::vector<double>                     output(4);
+
+    NS::NumberParsing::ParseBatch(bytes.data(), offsets.data(), 4, output.data());
+
+    CHECK(output[0] == 1.5);
+    CHECK(output[1] == -2.0);
+    CHECK(output[2] == 300.0);
+    CHECK(std::isnan(output[3]));
+
+    std::vector<size_t> const               invalidOffsets{ 0, 5 };
+
+    CHECK_THROWS_WITH(NS::NumberParsing::ParseBatch(bytes.data(), invalidOffsets.data(), 1, output.data()), "Invalid conversion");
+
+    std::vector<size_t> const               decreasingOffsets{ 3, 0 };
+
+    CHECK_THROWS_WITH(NS::NumberParsing::ParseBatch(bytes.data(), decreasingOffsets.data(), 1, output.data()), "pOffsets");
+
+    NS::NumberParsing::ParseBatch(bytes.data(), offsets.data(), 0, output.data());
+}